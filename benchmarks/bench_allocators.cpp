@@ -0,0 +1,804 @@
+/******************************************************************************/
+/*!
+ * @file   bench_allocators.cpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Throughput and latency benchmarks for each allocator compared against malloc,
+ *   along with the cost of the `Allocator<>` policies and polymorphic dispatch.
+ *
+ *   Build with `-DBF_MEMORY_BUILD_BENCHMARKS=ON` in a release configuration.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#include "memory/array.hpp"
+#include "memory/default_heap.hpp"
+#include "memory/fixed_mt_allocators.hpp"
+#include "memory/fixed_st_allocators.hpp"
+#include "memory/growing_mt_allocators.hpp"
+#include "memory/growing_st_allocators.hpp"
+#include "memory/lock_policies.hpp"
+#include "memory/memory_api.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>  // sort
+#include <atomic>     // atomic
+#include <chrono>     // steady_clock
+#include <cstdlib>    // malloc, free
+#include <cstring>    // memcpy
+#include <memory>     // unique_ptr
+#include <random>     // mt19937
+#include <utility>    // exchange
+#include <vector>     // vector
+
+using namespace Memory;
+
+//-------------------------------------------------------------------------------------//
+// Workloads
+//-------------------------------------------------------------------------------------//
+
+namespace
+{
+  constexpr MemoryIndex NumAllocationsPerBatch = 1024u;
+  constexpr MemoryIndex FixedSize              = 64u;
+  constexpr MemoryIndex MaxMixedSize           = 4096u;
+  constexpr MemoryIndex BenchAlignment         = DefaultAlignment;
+  constexpr MemoryIndex ArenaSize              = bfMegabytes(16);
+
+  // Mostly small sizes with a long tail, roughly the shape of a typical application heap.
+  std::vector<MemoryIndex> MakeMixedSizes(const MemoryIndex count)
+  {
+    std::mt19937             rng{1234u};
+    std::vector<MemoryIndex> sizes(count);
+
+    for (MemoryIndex& size : sizes)
+    {
+      const unsigned int bucket = rng() % 100u;
+
+      if (bucket < 80u)
+      {
+        size = 8u + rng() % 120u;
+      }
+      else if (bucket < 95u)
+      {
+        size = 128u + rng() % 896u;
+      }
+      else
+      {
+        size = 1024u + rng() % (MaxMixedSize - 1024u);
+      }
+    }
+
+    return sizes;
+  }
+
+  const std::vector<MemoryIndex>& MixedSizes()
+  {
+    static const std::vector<MemoryIndex> s_Sizes = MakeMixedSizes(NumAllocationsPerBatch);
+    return s_Sizes;
+  }
+
+  const std::vector<MemoryIndex>& FixedSizes()
+  {
+    static const std::vector<MemoryIndex> s_Sizes(NumAllocationsPerBatch, FixedSize);
+    return s_Sizes;
+  }
+
+  // Shuffled free order to defeat allocators that are only fast for LIFO frees.
+  const std::vector<MemoryIndex>& RandomFreeOrder()
+  {
+    static const std::vector<MemoryIndex> s_Order = []() {
+      std::vector<MemoryIndex> order(NumAllocationsPerBatch);
+
+      for (MemoryIndex index = 0u; index < order.size(); ++index)
+      {
+        order[index] = index;
+      }
+
+      std::shuffle(order.begin(), order.end(), std::mt19937{5678u});
+      return order;
+    }();
+
+    return s_Order;
+  }
+
+  struct MallocAllocator
+  {
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex, const AllocationSourceInfo&) noexcept
+    {
+      return AllocationResult{std::malloc(size), size};
+    }
+
+    void Deallocate(void* const ptr, const MemoryIndex, const MemoryIndex) noexcept
+    {
+      std::free(ptr);
+    }
+  };
+
+  struct DefaultHeapAllocator
+  {
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+    {
+      return DefaultHeap().Allocate(size, alignment, source_info);
+    }
+
+    void Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
+    {
+      DefaultHeap().Deallocate(ptr, size, alignment);
+    }
+  };
+
+  // Parent for the growing allocators, malloc already satisfies `BenchAlignment`.
+  using MallocHeap = Allocator<MallocAllocator, AllocationMarkPolicy::UNMARKED, BoundCheckingPolicy::UNCHECKED>;
+
+  MallocHeap& ParentHeap()
+  {
+    static MallocHeap s_Heap{};
+    return s_Heap;
+  }
+
+  struct ArenaMemory
+  {
+    std::unique_ptr<byte[]> memory;
+
+    explicit ArenaMemory(const MemoryIndex size = ArenaSize) :
+      memory{new byte[size]}
+    {
+    }
+
+    byte* data() const { return memory.get(); }
+  };
+
+  //
+  // Each fixture constructs a fresh allocator, `Reset` is called between batches
+  // for allocators that do not support individual frees.
+  //
+
+  struct MallocFixture
+  {
+    MallocAllocator allocator;
+    void            Reset() {}
+  };
+
+  struct DefaultHeapFixture
+  {
+    DefaultHeapAllocator allocator;
+    void                 Reset() {}
+  };
+
+  struct LinearFixture
+  {
+    ArenaMemory     memory;
+    LinearAllocator allocator{memory.data(), ArenaSize};
+    void            Reset() { allocator.Clear(); }
+  };
+
+  struct StackFixture
+  {
+    ArenaMemory    memory;
+    StackAllocator allocator{memory.data(), ArenaSize};
+    void           Reset() {}
+  };
+
+  struct PoolFixture
+  {
+    ArenaMemory   memory;
+    PoolAllocator allocator{memory.data(), ArenaSize, MaxMixedSize, BenchAlignment};
+    void          Reset() {}
+  };
+
+  struct FreeListFixture
+  {
+    ArenaMemory       memory;
+    FreeListAllocator allocator{memory.data(), ArenaSize};
+    void              Reset() {}
+  };
+
+  struct TLSFFixture
+  {
+    ArenaMemory   memory;
+    TLSFAllocator allocator{memory.data(), ArenaSize};
+    void          Reset() {}
+  };
+
+  struct GrowingPoolFixture
+  {
+    GrowingPoolAllocator allocator{ParentHeap(), MaxMixedSize, BenchAlignment, 256u};
+    void                 Reset() {}
+  };
+
+  // Sizes above 1024 in the mixed distribution go to the fallback.
+  struct SizeClassPoolFixture
+  {
+    SizeClassPoolAllocator<16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024> allocator{ParentHeap(), ParentHeap()};
+    void                                                                           Reset() {}
+  };
+
+  struct ConcurrentLinearFixture
+  {
+    ArenaMemory               memory;
+    ConcurrentLinearAllocator allocator{memory.data(), ArenaSize};
+    void                      Reset() { allocator.Clear(); }
+  };
+
+  struct ConcurrentPoolFixture
+  {
+    ArenaMemory             memory;
+    ConcurrentPoolAllocator allocator{memory.data(), ArenaSize, MaxMixedSize, BenchAlignment};
+    void                    Reset() {}
+  };
+
+  enum class FreeOrder
+  {
+    LIFO,
+    RANDOM,
+  };
+
+  enum class SizeDistribution
+  {
+    FIXED,
+    MIXED,
+  };
+
+  template<typename Fixture, FreeOrder order, SizeDistribution distribution>
+  void BM_AllocateFreeBatch(benchmark::State& state)
+  {
+    const std::vector<MemoryIndex>& sizes = distribution == SizeDistribution::FIXED ? FixedSizes() : MixedSizes();
+    Fixture                         fixture;
+    std::vector<void*> ptrs(sizes.size());
+
+    for (auto _ : state)
+    {
+      for (MemoryIndex index = 0u; index < sizes.size(); ++index)
+      {
+        ptrs[index] = fixture.allocator.Allocate(sizes[index], BenchAlignment, MemoryMakeAllocationSourceInfo()).ptr;
+      }
+
+      benchmark::DoNotOptimize(ptrs.data());
+      benchmark::ClobberMemory();
+
+      if constexpr (order == FreeOrder::LIFO)
+      {
+        for (MemoryIndex index = sizes.size(); index-- > 0u;)
+        {
+          fixture.allocator.Deallocate(ptrs[index], sizes[index], BenchAlignment);
+        }
+      }
+      else
+      {
+        for (const MemoryIndex index : RandomFreeOrder())
+        {
+          fixture.allocator.Deallocate(ptrs[index], sizes[index], BenchAlignment);
+        }
+      }
+
+      fixture.Reset();
+    }
+
+    state.SetItemsProcessed(state.iterations() * sizes.size());
+  }
+
+  // Times each allocation individually and reports percentiles in nanoseconds.
+  template<typename Fixture>
+  void BM_AllocateLatency(benchmark::State& state)
+  {
+    using Clock = std::chrono::steady_clock;
+
+    const std::vector<MemoryIndex>& sizes = MixedSizes();
+    Fixture                         fixture;
+    std::vector<void*>              ptrs(sizes.size());
+    std::vector<double>             latencies;
+
+    latencies.reserve(1u << 20u);
+
+    for (auto _ : state)
+    {
+      for (MemoryIndex index = 0u; index < sizes.size(); ++index)
+      {
+        const Clock::time_point start = Clock::now();
+        ptrs[index]                   = fixture.allocator.Allocate(sizes[index], BenchAlignment, MemoryMakeAllocationSourceInfo()).ptr;
+        const Clock::time_point end   = Clock::now();
+
+        if (latencies.size() < latencies.capacity())
+        {
+          latencies.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+        }
+      }
+
+      for (MemoryIndex index = sizes.size(); index-- > 0u;)
+      {
+        fixture.allocator.Deallocate(ptrs[index], sizes[index], BenchAlignment);
+      }
+
+      fixture.Reset();
+    }
+
+    if (!latencies.empty())
+    {
+      std::sort(latencies.begin(), latencies.end());
+
+      const auto Percentile = [&latencies](const double p) {
+        return latencies[std::size_t(p * double(latencies.size() - 1u))];
+      };
+
+      state.counters["p50_ns"]  = Percentile(0.50);
+      state.counters["p99_ns"]  = Percentile(0.99);
+      state.counters["p999_ns"] = Percentile(0.999);
+      state.counters["max_ns"]  = latencies.back();
+    }
+
+    state.SetItemsProcessed(state.iterations() * sizes.size());
+  }
+}  // namespace
+
+#define BF_BENCHMARK_SINGLE_THREADED(fixture)                                                                                         \
+  BENCHMARK_TEMPLATE(BM_AllocateFreeBatch, fixture, FreeOrder::LIFO, SizeDistribution::FIXED)->Name(#fixture "/Fixed/LIFO");     \
+  BENCHMARK_TEMPLATE(BM_AllocateFreeBatch, fixture, FreeOrder::LIFO, SizeDistribution::MIXED)->Name(#fixture "/Mixed/LIFO");     \
+  BENCHMARK_TEMPLATE(BM_AllocateFreeBatch, fixture, FreeOrder::RANDOM, SizeDistribution::MIXED)->Name(#fixture "/Mixed/Random"); \
+  BENCHMARK_TEMPLATE(BM_AllocateLatency, fixture)->Name(#fixture "/Mixed/Latency")
+
+BF_BENCHMARK_SINGLE_THREADED(MallocFixture);
+BF_BENCHMARK_SINGLE_THREADED(DefaultHeapFixture);
+BF_BENCHMARK_SINGLE_THREADED(LinearFixture);
+BF_BENCHMARK_SINGLE_THREADED(PoolFixture);
+BF_BENCHMARK_SINGLE_THREADED(FreeListFixture);
+BF_BENCHMARK_SINGLE_THREADED(TLSFFixture);
+BF_BENCHMARK_SINGLE_THREADED(GrowingPoolFixture);
+BF_BENCHMARK_SINGLE_THREADED(SizeClassPoolFixture);
+BF_BENCHMARK_SINGLE_THREADED(ConcurrentLinearFixture);
+BF_BENCHMARK_SINGLE_THREADED(ConcurrentPoolFixture);
+
+// The stack allocator only supports LIFO frees.
+BENCHMARK_TEMPLATE(BM_AllocateFreeBatch, StackFixture, FreeOrder::LIFO, SizeDistribution::FIXED)->Name("StackFixture/Fixed/LIFO");
+BENCHMARK_TEMPLATE(BM_AllocateFreeBatch, StackFixture, FreeOrder::LIFO, SizeDistribution::MIXED)->Name("StackFixture/Mixed/LIFO");
+
+//-------------------------------------------------------------------------------------//
+// Multi-threaded
+//-------------------------------------------------------------------------------------//
+
+namespace
+{
+  constexpr int MaxBenchThreads = 16;
+
+  // Every thread allocates and frees its own batch.
+  template<typename AllocatorType>
+  void BM_ThreadLocalChurn(benchmark::State& state, AllocatorType* allocator)
+  {
+    const std::vector<MemoryIndex>& sizes = MixedSizes();
+    std::vector<void*>              ptrs(sizes.size());
+
+    for (auto _ : state)
+    {
+      for (MemoryIndex index = 0u; index < sizes.size(); ++index)
+      {
+        ptrs[index] = allocator->Allocate(sizes[index], BenchAlignment, MemoryMakeAllocationSourceInfo()).ptr;
+      }
+
+      benchmark::DoNotOptimize(ptrs.data());
+
+      for (MemoryIndex index = sizes.size(); index-- > 0u;)
+      {
+        allocator->Deallocate(ptrs[index], sizes[index], BenchAlignment);
+      }
+    }
+
+    state.SetItemsProcessed(state.iterations() * sizes.size());
+  }
+
+  // Single producer single consumer ring used to pass allocations between threads.
+  struct alignas(CacheLineSize) HandoffQueue
+  {
+    static constexpr MemoryIndex Capacity = 1024u;
+
+    alignas(CacheLineSize) std::atomic<MemoryIndex> head{0u};
+    alignas(CacheLineSize) std::atomic<MemoryIndex> tail{0u};
+    void* items[Capacity];
+
+    void Push(void* const item)
+    {
+      const MemoryIndex t = tail.load(std::memory_order_relaxed);
+
+      while (t - head.load(std::memory_order_acquire) == Capacity)
+      {
+        CpuRelax();
+      }
+
+      items[t % Capacity] = item;
+      tail.store(t + 1u, std::memory_order_release);
+    }
+
+    void* Pop()
+    {
+      const MemoryIndex h = head.load(std::memory_order_relaxed);
+
+      while (tail.load(std::memory_order_acquire) == h)
+      {
+        CpuRelax();
+      }
+
+      void* const item = items[h % Capacity];
+      head.store(h + 1u, std::memory_order_release);
+      return item;
+    }
+  };
+
+  HandoffQueue g_HandoffQueues[MaxBenchThreads / 2];
+
+  // Even threads allocate, odd threads free what their partner allocated,
+  // the pattern that defeats allocators which assume memory is freed by the thread that allocated it.
+  template<typename AllocatorType>
+  void BM_ProducerConsumer(benchmark::State& state, AllocatorType* allocator)
+  {
+    HandoffQueue&     queue       = g_HandoffQueues[state.thread_index() / 2];
+    const bool        is_producer = (state.thread_index() % 2) == 0;
+    const MemoryIndex size        = FixedSize;
+
+    for (auto _ : state)
+    {
+      if (is_producer)
+      {
+        queue.Push(allocator->Allocate(size, BenchAlignment, MemoryMakeAllocationSourceInfo()).ptr);
+      }
+      else
+      {
+        allocator->Deallocate(queue.Pop(), size, BenchAlignment);
+      }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  MallocAllocator      g_Malloc;
+  DefaultHeapAllocator g_DefaultHeap;
+
+  using SpinLockedFreeList = Allocator<FreeListAllocator, AllocationMarkPolicy::UNMARKED, BoundCheckingPolicy::UNCHECKED, NoMemoryTracking, SpinLock>;
+  using MutexFreeList      = Allocator<FreeListAllocator, AllocationMarkPolicy::UNMARKED, BoundCheckingPolicy::UNCHECKED, NoMemoryTracking, MutexLock>;
+
+  // Enough blocks for every thread to have a full batch out at once.
+  constexpr MemoryIndex MtPoolArenaSize = MaxMixedSize * NumAllocationsPerBatch * MaxBenchThreads;
+
+  ArenaMemory g_MtArenas[3] = {ArenaMemory{MtPoolArenaSize}, ArenaMemory{}, ArenaMemory{}};
+
+  ConcurrentPoolAllocator        g_ConcurrentPool{g_MtArenas[0].data(), MtPoolArenaSize, MaxMixedSize, BenchAlignment};
+  ConcurrentGrowingPoolAllocator g_ConcurrentGrowingPool{ParentHeap(), MaxMixedSize, BenchAlignment, 256u};
+  SpinLockedFreeList             g_SpinLockedFreeList{g_MtArenas[1].data(), ArenaSize};
+  MutexFreeList                  g_MutexFreeList{g_MtArenas[2].data(), ArenaSize};
+}  // namespace
+
+#define BF_BENCHMARK_MULTI_THREADED(name, allocator_ptr)                                                       \
+  BENCHMARK_CAPTURE(BM_ThreadLocalChurn, name, allocator_ptr)->ThreadRange(1, MaxBenchThreads)->UseRealTime(); \
+  BENCHMARK_CAPTURE(BM_ProducerConsumer, name, allocator_ptr)->DenseThreadRange(2, MaxBenchThreads, 2)->UseRealTime()
+
+BF_BENCHMARK_MULTI_THREADED(Malloc, &g_Malloc);
+BF_BENCHMARK_MULTI_THREADED(DefaultHeap, &g_DefaultHeap);
+BF_BENCHMARK_MULTI_THREADED(ConcurrentPool, &g_ConcurrentPool);
+BF_BENCHMARK_MULTI_THREADED(ConcurrentGrowingPool, &g_ConcurrentGrowingPool);
+BF_BENCHMARK_MULTI_THREADED(FreeListSpinLock, &g_SpinLockedFreeList);
+BF_BENCHMARK_MULTI_THREADED(FreeListMutex, &g_MutexFreeList);
+
+//
+// Clearing while other threads allocate is not allowed so the linear
+// allocators are only measured single threaded per instance.
+//
+
+namespace
+{
+  constexpr MemoryIndex LinearMtIterations = 1u << 15u;  //!< With 16 byte allocations keeps every thread within the arena.
+
+  std::unique_ptr<ConcurrentLinearAllocator> g_ConcurrentLinear;
+
+  void BM_ConcurrentLinearShared(benchmark::State& state, const MemoryIndex thread_region_size)
+  {
+    static ArenaMemory s_Memory;
+
+    // Threads start and stop the benchmark loop together so this is safe.
+    if (state.thread_index() == 0)
+    {
+      g_ConcurrentLinear = std::make_unique<ConcurrentLinearAllocator>(s_Memory.data(), ArenaSize, thread_region_size);
+    }
+
+    for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(g_ConcurrentLinear->Allocate(16u, 8u, MemoryMakeAllocationSourceInfo()));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+      state.counters["wasted_bytes"] = double(g_ConcurrentLinear->WastedBytes());
+    }
+  }
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_ConcurrentLinearShared, shared_fetch_add, MemoryIndex(0u))->ThreadRange(1, MaxBenchThreads)->Iterations(LinearMtIterations)->UseRealTime();
+BENCHMARK_CAPTURE(BM_ConcurrentLinearShared, thread_regions, ConcurrentLinearAllocator::DefaultThreadRegionSize)->ThreadRange(1, MaxBenchThreads)->Iterations(LinearMtIterations)->UseRealTime();
+
+//-------------------------------------------------------------------------------------//
+// Resize
+//-------------------------------------------------------------------------------------//
+
+namespace
+{
+  constexpr MemoryIndex GrowStepSize  = 64u;
+  constexpr MemoryIndex GrowFinalSize = bfKilobytes(16);  // The copying version leaves every old buffer behind so keep the total within `ArenaSize`.
+
+  // Grows a vector-like buffer at the top of a linear arena one step at a time.
+  template<bool k_ResizeInPlace>
+  void BM_GrowBuffer(benchmark::State& state)
+  {
+    ArenaMemory     memory;
+    LinearAllocator allocator{memory.data(), ArenaSize};
+
+    for (auto _ : state)
+    {
+      MemoryIndex      size   = GrowStepSize;
+      AllocationResult buffer = bfMemAllocate(allocator, size, BenchAlignment);
+
+      while (size < GrowFinalSize)
+      {
+        const MemoryIndex new_size = size + GrowStepSize;
+
+        if constexpr (k_ResizeInPlace)
+        {
+          buffer = bfMemReallocate(allocator, buffer.ptr, size, new_size, BenchAlignment);
+        }
+        else
+        {
+          const AllocationResult new_buffer = bfMemAllocate(allocator, new_size, BenchAlignment);
+          std::memcpy(new_buffer.ptr, buffer.ptr, size);
+          bfMemDeallocate(allocator, buffer.ptr, size, BenchAlignment);
+          buffer = new_buffer;
+        }
+
+        size = new_size;
+      }
+
+      benchmark::DoNotOptimize(buffer.ptr);
+      allocator.Clear();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (GrowFinalSize / GrowStepSize));
+  }
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_GrowBuffer, false)->Name("Resize/Linear/AllocateCopy");
+BENCHMARK_TEMPLATE(BM_GrowBuffer, true)->Name("Resize/Linear/InPlace");
+
+//-------------------------------------------------------------------------------------//
+// Batch
+//-------------------------------------------------------------------------------------//
+
+namespace
+{
+  using BatchPool = Allocator<PoolAllocator, AllocationMarkPolicy::UNMARKED, BoundCheckingPolicy::UNCHECKED, NoMemoryTracking, SpinLock>;
+
+  // Same-size objects through the type erased view, one indirect call and lock per object vs per batch.
+  template<bool k_Batched>
+  void BM_PoolBatch(benchmark::State& state)
+  {
+    ArenaMemory         memory;
+    BatchPool           allocator{memory.data(), ArenaSize, FixedSize, BenchAlignment};
+    const AllocatorView view{allocator};
+    std::vector<void*>  ptrs(NumAllocationsPerBatch);
+
+    for (auto _ : state)
+    {
+      if constexpr (k_Batched)
+      {
+        bfMemAllocateBatch(view, ptrs.data(), ptrs.size(), FixedSize, BenchAlignment);
+        benchmark::DoNotOptimize(ptrs.data());
+        bfMemDeallocateBatch(view, ptrs.data(), ptrs.size(), FixedSize, BenchAlignment);
+      }
+      else
+      {
+        for (void*& ptr : ptrs)
+        {
+          ptr = bfMemAllocate(view, FixedSize, BenchAlignment).ptr;
+        }
+
+        benchmark::DoNotOptimize(ptrs.data());
+
+        for (void* const ptr : ptrs)
+        {
+          bfMemDeallocate(view, ptr, FixedSize, BenchAlignment);
+        }
+      }
+    }
+
+    state.SetItemsProcessed(state.iterations() * ptrs.size());
+  }
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_PoolBatch, false)->Name("Batch/Pool/Single");
+BENCHMARK_TEMPLATE(BM_PoolBatch, true)->Name("Batch/Pool/Batched");
+
+//-------------------------------------------------------------------------------------//
+// Relocation
+//-------------------------------------------------------------------------------------//
+
+namespace
+{
+  // Owning handle with a user provided move, not trivially copyable so relocation has to opt in.
+  template<bool k_Relocatable>
+  struct BenchHandle
+  {
+    std::uint64_t id;
+
+    BenchHandle(const std::uint64_t id) noexcept :
+      id{id}
+    {
+    }
+
+    BenchHandle(BenchHandle&& rhs) noexcept :
+      id{std::exchange(rhs.id, 0u)}
+    {
+    }
+
+    ~BenchHandle() { benchmark::DoNotOptimize(id); }
+  };
+}  // namespace
+
+namespace bf
+{
+  template<>
+  struct is_trivially_relocatable<BenchHandle<true>> : public std::true_type
+  {
+  };
+}  // namespace bf
+
+namespace
+{
+  constexpr std::size_t NumArrayElements = 1u << 16;
+
+  template<bool k_Relocatable>
+  void BM_ArrayGrow(benchmark::State& state)
+  {
+    for (auto _ : state)
+    {
+      bf::Array<BenchHandle<k_Relocatable>> array{ParentHeap()};
+
+      for (std::size_t i = 0u; i < NumArrayElements; ++i)
+      {
+        array.emplace_back(i);
+      }
+
+      benchmark::DoNotOptimize(array.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * NumArrayElements);
+  }
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ArrayGrow, false)->Name("Relocate/Array/MoveConstruct");
+BENCHMARK_TEMPLATE(BM_ArrayGrow, true)->Name("Relocate/Array/Memcpy");
+
+//-------------------------------------------------------------------------------------//
+// Allocator<> Policies and Dispatch
+//-------------------------------------------------------------------------------------//
+
+namespace
+{
+  template<AllocationMarkPolicy MarkPolicy, BoundCheckingPolicy BoundCheck>
+  using PolicyPool = Allocator<PoolAllocator, MarkPolicy, BoundCheck>;
+
+  // The allocation size is the benchmark argument, large sizes show the cost of patterning every byte.
+  template<AllocationMarkPolicy MarkPolicy, BoundCheckingPolicy BoundCheck>
+  void BM_PolicyCost(benchmark::State& state)
+  {
+    const MemoryIndex allocation_size = MemoryIndex(state.range(0));
+
+    // Guard bytes are added around each allocation so the blocks need room for them.
+    const MemoryIndex policy_block_size = allocation_size + 4u * BenchAlignment;
+
+    ArenaMemory                        memory;
+    PolicyPool<MarkPolicy, BoundCheck> allocator{memory.data(), ArenaSize, policy_block_size, BenchAlignment};
+    std::vector<void*>                 ptrs(NumAllocationsPerBatch);
+
+    for (auto _ : state)
+    {
+      for (void*& ptr : ptrs)
+      {
+        ptr = allocator.Allocate(allocation_size, BenchAlignment, MemoryMakeAllocationSourceInfo()).ptr;
+      }
+
+      benchmark::DoNotOptimize(ptrs.data());
+
+      for (void* const ptr : ptrs)
+      {
+        allocator.Deallocate(ptr, allocation_size, BenchAlignment);
+      }
+    }
+
+    state.SetItemsProcessed(state.iterations() * ptrs.size());
+  }
+
+  using DispatchPool = Allocator<PoolAllocator, AllocationMarkPolicy::UNMARKED, BoundCheckingPolicy::UNCHECKED>;
+
+  void BM_StaticDispatch(benchmark::State& state)
+  {
+    ArenaMemory        memory;
+    DispatchPool       allocator{memory.data(), ArenaSize, FixedSize, BenchAlignment};
+    std::vector<void*> ptrs(NumAllocationsPerBatch);
+
+    for (auto _ : state)
+    {
+      for (void*& ptr : ptrs)
+      {
+        ptr = allocator.Allocate(FixedSize, BenchAlignment, MemoryMakeAllocationSourceInfo()).ptr;
+      }
+
+      benchmark::DoNotOptimize(ptrs.data());
+
+      for (void* const ptr : ptrs)
+      {
+        allocator.Deallocate(ptr, FixedSize, BenchAlignment);
+      }
+    }
+
+    state.SetItemsProcessed(state.iterations() * ptrs.size());
+  }
+
+  void BM_PolymorphicDispatch(benchmark::State& state)
+  {
+    ArenaMemory            memory;
+    DispatchPool           allocator{memory.data(), ArenaSize, FixedSize, BenchAlignment};
+    IPolymorphicAllocator* polymorphic = &allocator;
+    std::vector<void*>     ptrs(NumAllocationsPerBatch);
+
+    // Hide the dynamic type from the optimizer so calls are not devirtualized.
+    benchmark::DoNotOptimize(polymorphic);
+
+    for (auto _ : state)
+    {
+      for (void*& ptr : ptrs)
+      {
+        ptr = (bfMemAllocate)(*polymorphic, FixedSize, BenchAlignment, MemoryMakeAllocationSourceInfo()).ptr;
+      }
+
+      benchmark::DoNotOptimize(ptrs.data());
+
+      for (void* const ptr : ptrs)
+      {
+        bfMemDeallocate(*polymorphic, ptr, FixedSize, BenchAlignment);
+      }
+    }
+
+    state.SetItemsProcessed(state.iterations() * ptrs.size());
+  }
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_PolicyCost, AllocationMarkPolicy::UNMARKED, BoundCheckingPolicy::UNCHECKED)->Name("Policy/Unmarked/Unchecked")->Arg(FixedSize)->Arg(MaxMixedSize);
+BENCHMARK_TEMPLATE(BM_PolicyCost, AllocationMarkPolicy::MARKED, BoundCheckingPolicy::UNCHECKED)->Name("Policy/Marked/Unchecked")->Arg(FixedSize)->Arg(MaxMixedSize);
+BENCHMARK_TEMPLATE(BM_PolicyCost, AllocationMarkPolicy::UNMARKED, BoundCheckingPolicy::CHECKED)->Name("Policy/Unmarked/Checked")->Arg(FixedSize)->Arg(MaxMixedSize);
+BENCHMARK_TEMPLATE(BM_PolicyCost, AllocationMarkPolicy::MARKED, BoundCheckingPolicy::CHECKED)->Name("Policy/Marked/Checked")->Arg(FixedSize)->Arg(MaxMixedSize);
+BENCHMARK_TEMPLATE(BM_PolicyCost, AllocationMarkPolicy::MARKED, BoundCheckingPolicy::CHECKED_COMPACT)->Name("Policy/Marked/CheckedCompact")->Arg(FixedSize)->Arg(MaxMixedSize);
+BENCHMARK(BM_StaticDispatch)->Name("Dispatch/Static");
+BENCHMARK(BM_PolymorphicDispatch)->Name("Dispatch/Polymorphic");
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
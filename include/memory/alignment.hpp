@@ -28,6 +28,8 @@ namespace Memory
 
   static constexpr MemoryIndex DefaultAlignment = DefaultMallocAlignment < DefaultNewAlignment ? DefaultNewAlignment : DefaultMallocAlignment; //!< An address aligned to this value can support any non-overaligned datatype.
 
+  static constexpr MemoryIndex CacheLineSize = 64u; //!< Alignment used to keep data written by different threads from sharing a cache line.
+
   /*!
    * @brief
    *   Returns if \p alignment is valid to be used for alignment of memory addresses.
@@ -82,7 +84,7 @@ namespace Memory
 
     const MemoryIndex required_alignment_mask = alignment - 1;
 
-    return size + required_alignment_mask & ~required_alignment_mask;
+    return (size + required_alignment_mask) & ~required_alignment_mask;
   }
 
   bool IsPointerAligned(const void* const ptr, const MemoryIndex alignment) noexcept;
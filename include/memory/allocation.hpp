@@ -13,6 +13,7 @@
 
 #include "basic_types.hpp"  // AllocationResult, MemoryIndex, AllocationSourceInfo, MemoryMakeAllocationSourceInfo
 
+#include <cstring>  // memcpy
 #include <new>      // placement new
 #include <utility>  // forward
 
@@ -141,6 +142,185 @@ void bfMemDeallocate(AllocatorConcept&& allocator, void* const ptr, const Memory
   return allocator.Deallocate(ptr, size, alignment);
 }
 
+/*!
+ * @brief
+ *   Attempts to grow or shrink the block \p ptr without moving it.
+ *
+ *   Allocators opt into this by implementing `Resize`, see `Memory::HasResizeOp`,
+ *   those that do not will always fail.
+ *
+ * @param allocator
+ *   The allocator \p ptr came from.
+ *
+ * @param ptr
+ *   The block of memory to resize.
+ *
+ * @param old_size
+ *   The size passed into bfMemAllocate (or the last successful resize).
+ *
+ * @param new_size
+ *   The minimum number of bytes the block should now contain.
+ *
+ * @param alignment
+ *   The alignment passed into bfMemAllocate.
+ *
+ * @param source_info
+ *   Optional information on where the resize came from.
+ *
+ * @return
+ *   The same pointer with the new usable size of the block.
+ *   AllocationResult::Null - if the block could not be resized in place, \p ptr is still valid with \p old_size.
+ *
+ * @see bfMemReallocate
+ */
+template<typename AllocatorConcept>
+AllocationResult bfMemResize(AllocatorConcept&& allocator, void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo& source_info)
+{
+  if (ptr && new_size != 0u)
+  {
+    return Memory::ResizeInPlace(allocator, ptr, old_size, new_size, alignment, source_info);
+  }
+
+  return AllocationResult::Null();
+}
+#define bfMemResize(allocator, ptr, old_size, new_size, alignment) (bfMemResize)((allocator), (ptr), (old_size), (new_size), (alignment), MemoryMakeAllocationSourceInfo())
+
+/*!
+ * @brief
+ *   Resizes \p ptr in place when possible otherwise allocates a new block,
+ *   copies over the bytes that fit and then frees the old block.
+ *
+ *   Since the bytes are memcpy'd this is only for trivially relocatable data.
+ *
+ * @param allocator
+ *   The allocator \p ptr came from.
+ *
+ * @param ptr
+ *   The block of memory to reallocate, nullptr is the same as bfMemAllocate.
+ *
+ * @param old_size
+ *   The size passed into bfMemAllocate (or the last successful resize).
+ *
+ * @param new_size
+ *   The minimum number of bytes the block should now contain, 0 is the same as bfMemDeallocate.
+ *
+ * @param alignment
+ *   The alignment passed into bfMemAllocate.
+ *
+ * @param source_info
+ *   Optional information on where the reallocation came from.
+ *
+ * @return
+ *   The, possibly moved, block of memory.
+ *   AllocationResult::Null - on failed allocation, \p ptr is still valid with \p old_size.
+ *
+ * @see bfMemResize
+ */
+template<typename AllocatorConcept>
+AllocationResult bfMemReallocate(AllocatorConcept&& allocator, void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo& source_info)
+{
+  if (!ptr)
+  {
+    return (bfMemAllocate)(allocator, new_size, alignment, source_info);
+  }
+
+  if (new_size == 0u)
+  {
+    bfMemDeallocate(allocator, ptr, old_size, alignment);
+    return AllocationResult::Null();
+  }
+
+  const AllocationResult resized = (bfMemResize)(allocator, ptr, old_size, new_size, alignment, source_info);
+
+  if (resized)
+  {
+    return resized;
+  }
+
+  const AllocationResult new_block = (bfMemAllocate)(allocator, new_size, alignment, source_info);
+
+  if (new_block)
+  {
+    std::memcpy(new_block.ptr, ptr, old_size < new_size ? old_size : new_size);
+    bfMemDeallocate(allocator, ptr, old_size, alignment);
+  }
+
+  return new_block;
+}
+#define bfMemReallocate(allocator, ptr, old_size, new_size, alignment) (bfMemReallocate)((allocator), (ptr), (old_size), (new_size), (alignment), MemoryMakeAllocationSourceInfo())
+
+/*!
+ * @brief
+ *   Allocates \p num_ptrs blocks of the same size and alignment in one call.
+ *
+ *   Allocators opt into a native batch by implementing `AllocateBatch`, see `Memory::HasAllocateBatchOp`,
+ *   otherwise this is the same as calling bfMemAllocate \p num_ptrs times.
+ *
+ * @param allocator
+ *   The allocator to request memory from.
+ *
+ * @param out_ptrs
+ *   Array of at least \p num_ptrs length the allocated blocks are written to.
+ *
+ * @param num_ptrs
+ *   The number of blocks to allocate.
+ *
+ * @param size
+ *   The minimum number of bytes for each block.
+ *
+ * @param alignment
+ *   The desired minimum alignment of each block.
+ *
+ * @param source_info
+ *   Optional information on where the allocation came from.
+ *
+ * @return
+ *   The number of blocks written to \p out_ptrs, less than \p num_ptrs if the allocator ran out of memory.
+ *
+ * @see bfMemDeallocateBatch
+ */
+template<typename AllocatorConcept>
+MemoryIndex bfMemAllocateBatch(AllocatorConcept&& allocator, void** const out_ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info)
+{
+  if (size != 0u && num_ptrs != 0u)
+  {
+    return Memory::AllocateBatchOrLoop(allocator, out_ptrs, num_ptrs, size, alignment, source_info);
+  }
+
+  return 0u;
+}
+#define bfMemAllocateBatch(allocator, out_ptrs, num_ptrs, size, alignment) (bfMemAllocateBatch)((allocator), (out_ptrs), (num_ptrs), (size), (alignment), MemoryMakeAllocationSourceInfo())
+
+/*!
+ * @brief
+ *   Returns \p num_ptrs blocks from bfMemAllocateBatch (or bfMemAllocate) back to \p allocator.
+ *
+ * @param allocator
+ *   The allocator to return memory to.
+ *
+ * @param ptrs
+ *   The blocks of memory to free, none of them can be nullptr.
+ *
+ * @param num_ptrs
+ *   The number of elements in \p ptrs.
+ *
+ * @param size
+ *   The size passed into bfMemAllocateBatch.
+ *
+ * @param alignment
+ *   The alignment passed into bfMemAllocateBatch.
+ *
+ * @see bfMemAllocateBatch
+ */
+template<typename AllocatorConcept>
+void bfMemDeallocateBatch(AllocatorConcept&& allocator, void* const* const ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment)
+{
+  if (num_ptrs != 0u)
+  {
+    Memory::DeallocateBatchOrLoop(allocator, ptrs, num_ptrs, size, alignment);
+  }
+}
+
 //-------------------------------------------------------------------------------------//
 // Single Object API: Calls constructor and destructors on the allocated memory.
 //-------------------------------------------------------------------------------------//
@@ -0,0 +1,281 @@
+/******************************************************************************/
+/*!
+ * @file   array.hpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Growable array built on `ScopedBuffer` with amortized geometric growth.
+ *
+ *   Growing relocates the elements with `bfMemUninitializedRelocate` so
+ *   buffers of `bf::is_trivially_relocatable` types grow at `memcpy` speed.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#ifndef BF_ARRAY_HPP
+#define BF_ARRAY_HPP
+
+#include "scoped_buffer.hpp"  // ScopedBuffer
+
+#include <memory>   // destroy, uninitialized_move
+#include <utility>  // forward, move
+
+namespace bf
+{
+  /*!
+   * @brief
+   *   Dynamic array, unlike `ScopedBuffer` only the first `size()` elements are
+   *   alive and they are destroyed when removed.
+   */
+  template<typename T>
+  class Array
+  {
+   public:
+    static constexpr std::size_t MinCapacity = 8u;  //!< First allocation size so small arrays do not grow one element at a time.
+
+   private:
+    ScopedBuffer<T> m_Storage;  //!< `m_Storage.size()` is the capacity.
+    std::size_t     m_Size;
+
+   public:
+    Array(IPolymorphicAllocator& memory) :
+      m_Storage{memory},
+      m_Size{0u}
+    {
+    }
+
+#if !BF_MEMORY_NO_DEFAULT_HEAP
+    Array() :
+      Array(Memory::DefaultHeap())
+    {
+    }
+#endif
+
+    Array(const Array& rhs)            = delete;
+    Array& operator=(const Array& rhs) = delete;
+
+    Array(Array&& rhs) noexcept :
+      m_Storage{rhs.m_Storage.memory},
+      m_Size{rhs.m_Size}
+    {
+      StealStorage(rhs);
+    }
+
+    // With different allocators the elements are moved one by one since the buffer cannot change hands,
+    // running out of memory doing so asserts and leaves \p rhs untouched.
+    Array& operator=(Array&& rhs)
+    {
+      if (this != &rhs)
+      {
+        clear();
+
+        if (&m_Storage.memory == &rhs.m_Storage.memory)
+        {
+          m_Storage.destroy();
+          m_Size = rhs.m_Size;
+          StealStorage(rhs);
+        }
+        else
+        {
+          const bool reserved = reserve(rhs.m_Size);
+          bfMemAssert(reserved, "Out of memory, the move assignment of %i elements was dropped.\n", int(rhs.m_Size));
+
+          if (reserved)
+          {
+            std::uninitialized_move(rhs.begin(), rhs.end(), begin());
+            m_Size = rhs.m_Size;
+            rhs.clear();
+          }
+        }
+      }
+
+      return *this;
+    }
+
+    std::size_t size() const { return m_Size; }
+    std::size_t capacity() const { return m_Storage.size(); }
+    bool        empty() const { return m_Size == 0u; }
+    T*          data() { return m_Storage.begin(); }
+    const T*    data() const { return m_Storage.begin(); }
+    T*          begin() { return m_Storage.begin(); }
+    T*          end() { return m_Storage.begin() + m_Size; }
+    const T*    begin() const { return m_Storage.begin(); }
+    const T*    end() const { return m_Storage.begin() + m_Size; }
+
+    T& operator[](const std::size_t index)
+    {
+      bfMemAssert(index < m_Size, "Out of bounds index (%i >= %i).\n", int(index), int(m_Size));
+      return m_Storage.buffer[index];
+    }
+
+    const T& operator[](const std::size_t index) const
+    {
+      bfMemAssert(index < m_Size, "Out of bounds index (%i >= %i).\n", int(index), int(m_Size));
+      return m_Storage.buffer[index];
+    }
+
+    T& back()
+    {
+      bfMemAssert(m_Size != 0u, "back called on an empty array.");
+      return m_Storage.buffer[m_Size - 1u];
+    }
+
+    // Returns true if the array can hold at least `new_capacity` elements.
+    bool reserve(const std::size_t new_capacity)
+    {
+      return new_capacity <= capacity() || m_Storage.relocate(new_capacity, m_Size);
+    }
+
+    // Returns the new element or nullptr if the array could not grow.
+    template<typename... Args>
+    T* emplace_back(Args&&... args)
+    {
+      if (m_Size == capacity())
+      {
+        return GrowAndEmplace(std::forward<Args>(args)...);
+      }
+
+      T* const element = new (m_Storage.buffer + m_Size) T(std::forward<Args>(args)...);
+      ++m_Size;
+
+      return element;
+    }
+
+    bool push_back(const T& value) { return emplace_back(value) != nullptr; }
+    bool push_back(T&& value) { return emplace_back(std::move(value)) != nullptr; }
+
+    void pop_back()
+    {
+      bfMemAssert(m_Size != 0u, "pop_back called on an empty array.");
+
+      --m_Size;
+      m_Storage.buffer[m_Size].~T();
+    }
+
+    // Returns true on a successful resize.
+    template<Memory::ArrayConstruct new_element_init = Memory::ArrayConstruct::VALUE_CONSTRUCT>
+    bool resize(const std::size_t new_size)
+    {
+      if (new_size < m_Size)
+      {
+        std::destroy(begin() + new_size, end());
+      }
+      else if (new_size > m_Size)
+      {
+        if (new_size > capacity() && !Grow(new_size))
+        {
+          return false;
+        }
+
+        const std::size_t num_new_elements = new_size - m_Size;
+
+        bfMemArrayConstruct<T, new_element_init>({end(), num_new_elements * sizeof(T)}, num_new_elements);
+      }
+
+      m_Size = new_size;
+
+      return true;
+    }
+
+    void clear()
+    {
+      std::destroy(begin(), end());
+      m_Size = 0u;
+    }
+
+    // Releases any capacity not used by the live elements.
+    bool shrink_to_fit()
+    {
+      return m_Storage.relocate(m_Size, m_Size);
+    }
+
+    ~Array() { clear(); }
+
+   private:
+    std::size_t GrownCapacity(const std::size_t min_capacity) const
+    {
+      const std::size_t doubled_capacity = capacity() * 2u;
+      const std::size_t new_capacity     = doubled_capacity > MinCapacity ? doubled_capacity : MinCapacity;
+
+      return new_capacity < min_capacity ? min_capacity : new_capacity;
+    }
+
+    bool Grow(const std::size_t min_capacity)
+    {
+      return m_Storage.relocate(GrownCapacity(min_capacity), m_Size);
+    }
+
+    // `args` may refer to an element of this array so the old buffer is kept alive until the new element is constructed.
+    template<typename... Args>
+    T* GrowAndEmplace(Args&&... args)
+    {
+      const std::size_t new_capacity = GrownCapacity(m_Size + 1u);
+
+      if (m_Storage.buffer && (bfMemResize)(m_Storage.memory, m_Storage.buffer, sizeof(T) * m_Storage.num_elements, sizeof(T) * new_capacity, alignof(T), MemoryMakeAllocationSourceInfo()))
+      {
+        m_Storage.num_elements = new_capacity;
+      }
+      else
+      {
+        T* const new_buffer = bfMemAllocateArray<T, Memory::ArrayConstruct::UNINITIALIZE>(m_Storage.memory, new_capacity);
+
+        if (!new_buffer)
+        {
+          return nullptr;
+        }
+
+        new (new_buffer + m_Size) T(std::forward<Args>(args)...);
+
+        bfMemUninitializedRelocate(m_Storage.buffer, m_Storage.buffer + m_Size, new_buffer);
+        bfMemDeallocateArray(m_Storage.memory, m_Storage.buffer, m_Storage.num_elements);
+
+        m_Storage.buffer       = new_buffer;
+        m_Storage.num_elements = new_capacity;
+
+        return new_buffer + m_Size++;
+      }
+
+      T* const element = new (m_Storage.buffer + m_Size) T(std::forward<Args>(args)...);
+      ++m_Size;
+
+      return element;
+    }
+
+    void StealStorage(Array& rhs) noexcept
+    {
+      m_Storage.buffer           = rhs.m_Storage.buffer;
+      m_Storage.num_elements     = rhs.m_Storage.num_elements;
+      rhs.m_Storage.buffer       = nullptr;
+      rhs.m_Storage.num_elements = 0u;
+      rhs.m_Size                 = 0u;
+    }
+  };
+}  // namespace bf
+
+#endif  // BF_ARRAY_HPP
+
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
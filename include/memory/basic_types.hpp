@@ -13,10 +13,17 @@
 
 #include "assertion.hpp"  // bfMemAssert
 
+#include <type_traits>  // void_t, true_type, false_type, is_same_v
+#include <utility>      // declval
+
 #ifndef BF_MEMORY_ALLOCATION_INFO
 #define BF_MEMORY_ALLOCATION_INFO 1
 #endif
 
+#ifndef BF_MEMORY_MARK_LIMIT
+#define BF_MEMORY_MARK_LIMIT 0  //!< When non zero a `MARKED` allocator only patterns this many bytes at each end of a block, 0 marks every byte.
+#endif
+
 using MemoryIndex = decltype(sizeof(int));  //!<
 
 using byte = unsigned char;  //!< Type to represent a single byte of memory.
@@ -30,11 +37,6 @@ constexpr bool WillMulOverflow(const MemoryIndex lhs, const MemoryIndex rhs)
   return (rhs > 1) ? (lhs > (MemoryIndex(-1) / rhs)) : false;
 }
 
-namespace Memory
-{
-  constexpr MemoryIndex AlignSize(const MemoryIndex size, const MemoryIndex alignment) noexcept;
-}
-
 /*!
  * @brief
  *   Helper type for calculating the size and alignment requirements of a single
@@ -88,7 +90,7 @@ struct MemoryRequirements
       return size;
     }
 
-    const MemoryIndex allocation_offset = Memory::AlignSize(size, element_alignment);
+    const MemoryIndex allocation_offset = (size + (element_alignment - 1u)) & ~(element_alignment - 1u);  // Memory::AlignSize, alignment.hpp depends on this header.
 
     size      = allocation_offset + allocation_size;
     alignment = (element_alignment > alignment) ? element_alignment : alignment;
@@ -152,7 +154,7 @@ struct AllocationResult
   }
 
   void*       ptr;        //!< Pointer to the starting address of the allocated block.
-  MemoryIndex num_bytes;  //!< Number of bytes allocated, could be greater than the amount of memory requested.
+  MemoryIndex num_bytes;  //!< Number of bytes allocated, could be greater than the amount of memory requested, any size from the requested amount up to this may be passed to `Deallocate`.
 
   AllocationResult() = default;
   constexpr AllocationResult(void* const ptr, const MemoryIndex num_bytes) :
@@ -188,16 +190,311 @@ struct AllocationSourceInfo
 
 enum class AllocationOp : MemoryIndex
 {
-  DO_ALLOCATE   = 0,
-  DO_DEALLOCATE = 1,
+  DO_ALLOCATE         = 0,
+  DO_DEALLOCATE       = 1,
+  DO_RESIZE           = 2,
+  DO_ALLOCATE_BATCH   = 3,
+  DO_DEALLOCATE_BATCH = 4,
+  DO_QUERY_STATS      = 5,
+};
+
+/*!
+ * @brief
+ *   The extra parameters for a `AllocationOp::DO_RESIZE`, the `size` parameter is the new size.
+ */
+struct AllocationResizeInfo
+{
+  void*                ptr;          //!< The block to resize.
+  MemoryIndex          old_size;     //!< The size the block was allocated (or last resized) with.
+  AllocationSourceInfo source_info;  //!< Where the resize came from.
+};
+
+/*!
+ * @brief
+ *   The extra parameters for a `AllocationOp::DO_ALLOCATE_BATCH` and `AllocationOp::DO_DEALLOCATE_BATCH`,
+ *   the `size` and `alignment` parameters are for each block in the batch.
+ */
+struct AllocationBatchInfo
+{
+  void**               ptrs;           //!< The blocks to free or where to write the allocated blocks.
+  MemoryIndex          num_ptrs;       //!< The number of elements in `ptrs`.
+  MemoryIndex          num_allocated;  //!< Output of `AllocationOp::DO_ALLOCATE_BATCH`, can be less than `num_ptrs` if the allocator ran out of memory.
+  AllocationSourceInfo source_info;    //!< Where the batch came from.
+};
+
+/*!
+ * @brief
+ *   Occupancy and fragmentation of an allocator, the output of a `AllocationOp::DO_QUERY_STATS`.
+ *
+ *   `used_bytes + free_bytes + overhead_bytes == total_bytes`, bookkeeping an
+ *   allocator cannot tell apart from its allocations is counted as used.
+ */
+struct AllocatorStats
+{
+  MemoryIndex total_bytes;         //!< All memory owned by the allocator, for a growing allocator everything it got from its parent.
+  MemoryIndex used_bytes;          //!< Bytes in blocks that have been handed out, including any rounding up of the requested size.
+  MemoryIndex free_bytes;          //!< Bytes that can still be handed out without asking a parent for more memory.
+  MemoryIndex overhead_bytes;      //!< Headers, footers, alignment padding and tails too small to be a block.
+  MemoryIndex largest_free_block;  //!< The largest allocation that can currently succeed (with default alignment) without growing.
+  MemoryIndex num_free_blocks;     //!< Number of separate free regions, for a pool each free block.
+
+  /*!
+   * @brief
+   *   0 when all of the free memory is a single block, approaching 1 as it is split into many small blocks.
+   *   A pool's blocks are all the same size so for pools this only says how many blocks are free.
+   */
+  float Fragmentation() const noexcept { return free_bytes != 0u ? 1.0f - float(largest_free_block) / float(free_bytes) : 0.0f; }
 };
 
 /*!
  * @brief
  *   ptr is a AllocationSourceInfo* ptr when op == DO_ALLOCATE.
+ *   ptr is a AllocationResizeInfo* ptr when op == DO_RESIZE.
+ *   ptr is a AllocationBatchInfo* ptr when op == DO_ALLOCATE_BATCH or op == DO_DEALLOCATE_BATCH.
+ *   ptr is a AllocatorStats* ptr when op == DO_QUERY_STATS, a non null result means the allocator filled it in.
  */
 using PolymorphicAllocatorFn = AllocationResult (*)(MemoryIndex size, MemoryIndex alignment, void* const ptr, const AllocationOp op, void* const self);
 
+namespace Memory
+{
+  /*!
+   * @brief
+   *   Whether or not an allocator implements the optional in place resize operation:
+   *   `AllocationResult Resize(void* ptr, MemoryIndex old_size, MemoryIndex new_size, MemoryIndex alignment, const AllocationSourceInfo& source_info)`.
+   *
+   *   On success the result is the same pointer with the new usable size, on failure
+   *   AllocationResult::Null is returned and the block is left untouched.
+   */
+  template<typename AllocatorConcept, typename = void>
+  struct HasResizeOp : public std::false_type
+  {
+  };
+
+  template<typename AllocatorConcept>
+  struct HasResizeOp<AllocatorConcept, std::void_t<decltype(std::declval<AllocatorConcept&>().Resize(std::declval<void*>(), MemoryIndex(0u), MemoryIndex(0u), MemoryIndex(0u), std::declval<const AllocationSourceInfo&>()))>> : public std::true_type
+  {
+  };
+
+  template<typename AllocatorConcept>
+  inline constexpr bool HasResizeOp_v = HasResizeOp<AllocatorConcept>::value;
+
+  /*!
+   * @brief
+   *   Calls `Resize` on allocators that support it, otherwise always fails.
+   */
+  template<typename AllocatorConcept>
+  AllocationResult ResizeInPlace(AllocatorConcept& allocator, void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+  {
+    if constexpr (HasResizeOp_v<AllocatorConcept>)
+    {
+      return allocator.Resize(ptr, old_size, new_size, alignment, source_info);
+    }
+    else
+    {
+      (void)allocator;
+      (void)ptr;
+      (void)old_size;
+      (void)new_size;
+      (void)alignment;
+      (void)source_info;
+
+      return AllocationResult::Null();
+    }
+  }
+
+  /*!
+   * @brief
+   *   Whether or not an allocator implements the optional batch operations:
+   *   `MemoryIndex AllocateBatch(void** out_ptrs, MemoryIndex num_ptrs, MemoryIndex size, MemoryIndex alignment, const AllocationSourceInfo& source_info)` and
+   *   `void DeallocateBatch(void* const* ptrs, MemoryIndex num_ptrs, MemoryIndex size, MemoryIndex alignment)`.
+   *
+   *   `AllocateBatch` returns the number of blocks written to `out_ptrs`.
+   */
+  template<typename AllocatorConcept, typename = void>
+  struct HasAllocateBatchOp : public std::false_type
+  {
+  };
+
+  template<typename AllocatorConcept>
+  struct HasAllocateBatchOp<AllocatorConcept, std::void_t<decltype(std::declval<AllocatorConcept&>().AllocateBatch(std::declval<void**>(), MemoryIndex(0u), MemoryIndex(0u), MemoryIndex(0u), std::declval<const AllocationSourceInfo&>()))>> : public std::true_type
+  {
+  };
+
+  template<typename AllocatorConcept, typename = void>
+  struct HasDeallocateBatchOp : public std::false_type
+  {
+  };
+
+  template<typename AllocatorConcept>
+  struct HasDeallocateBatchOp<AllocatorConcept, std::void_t<decltype(std::declval<AllocatorConcept&>().DeallocateBatch(std::declval<void* const*>(), MemoryIndex(0u), MemoryIndex(0u), MemoryIndex(0u)))>> : public std::true_type
+  {
+  };
+
+  template<typename AllocatorConcept>
+  inline constexpr bool HasAllocateBatchOp_v = HasAllocateBatchOp<AllocatorConcept>::value;
+
+  template<typename AllocatorConcept>
+  inline constexpr bool HasDeallocateBatchOp_v = HasDeallocateBatchOp<AllocatorConcept>::value;
+
+  /*!
+   * @brief
+   *   Calls `AllocateBatch` on allocators that support it, otherwise allocates one block at a time.
+   *
+   * @return
+   *   The number of blocks written to \p out_ptrs, stops at the first failed allocation.
+   */
+  template<typename AllocatorConcept>
+  MemoryIndex AllocateBatchOrLoop(AllocatorConcept& allocator, void** const out_ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+  {
+    if constexpr (HasAllocateBatchOp_v<AllocatorConcept>)
+    {
+      return allocator.AllocateBatch(out_ptrs, num_ptrs, size, alignment, source_info);
+    }
+    else
+    {
+      MemoryIndex num_allocated = 0u;
+
+      while (num_allocated < num_ptrs)
+      {
+        void* const ptr = allocator.Allocate(size, alignment, source_info).ptr;
+
+        if (!ptr)
+        {
+          break;
+        }
+
+        out_ptrs[num_allocated++] = ptr;
+      }
+
+      return num_allocated;
+    }
+  }
+
+  /*!
+   * @brief
+   *   Calls `DeallocateBatch` on allocators that support it, otherwise frees one block at a time.
+   */
+  template<typename AllocatorConcept>
+  void DeallocateBatchOrLoop(AllocatorConcept& allocator, void* const* const ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment) noexcept
+  {
+    if constexpr (HasDeallocateBatchOp_v<AllocatorConcept>)
+    {
+      allocator.DeallocateBatch(ptrs, num_ptrs, size, alignment);
+    }
+    else
+    {
+      for (MemoryIndex index = 0u; index < num_ptrs; ++index)
+      {
+        allocator.Deallocate(ptrs[index], size, alignment);
+      }
+    }
+  }
+
+  /*!
+   * @brief
+   *   Whether or not an allocator implements the optional introspection operation:
+   *   `void QueryStats(AllocatorStats& out_stats) const`.
+   *
+   *   Adaptors that only sometimes support it instead return a `bool` of whether \p out_stats was filled in.
+   */
+  template<typename AllocatorConcept, typename = void>
+  struct HasQueryStatsOp : public std::false_type
+  {
+  };
+
+  template<typename AllocatorConcept>
+  struct HasQueryStatsOp<AllocatorConcept, std::void_t<decltype(std::declval<AllocatorConcept&>().QueryStats(std::declval<AllocatorStats&>()))>> : public std::true_type
+  {
+  };
+
+  template<typename AllocatorConcept>
+  inline constexpr bool HasQueryStatsOp_v = HasQueryStatsOp<AllocatorConcept>::value;
+
+  /*!
+   * @brief
+   *   Calls `QueryStats` on allocators that support it.
+   *
+   * @return
+   *   false if the allocator does not support it, \p out_stats is left zeroed.
+   */
+  template<typename AllocatorConcept>
+  bool QueryStatsIfSupported(AllocatorConcept& allocator, AllocatorStats& out_stats) noexcept
+  {
+    out_stats = {};
+
+    if constexpr (HasQueryStatsOp_v<AllocatorConcept>)
+    {
+      if constexpr (std::is_same_v<decltype(allocator.QueryStats(out_stats)), bool>)
+      {
+        return allocator.QueryStats(out_stats);
+      }
+      else
+      {
+        allocator.QueryStats(out_stats);
+        return true;
+      }
+    }
+    else
+    {
+      (void)allocator;
+      return false;
+    }
+  }
+
+  /*!
+   * @brief
+   *   Shared implementation of the `PolymorphicAllocatorFn` for a concrete allocator type.
+   */
+  template<typename AllocatorConcept>
+  AllocationResult PolymorphicAllocatorDispatch(AllocatorConcept& allocator, const MemoryIndex size, const MemoryIndex alignment, void* const ptr, const AllocationOp op) noexcept
+  {
+    switch (op)
+    {
+      case AllocationOp::DO_ALLOCATE:
+      {
+        return allocator.Allocate(size, alignment, *static_cast<const AllocationSourceInfo*>(ptr));
+      }
+      case AllocationOp::DO_DEALLOCATE:
+      {
+        allocator.Deallocate(ptr, size, alignment);
+        break;
+      }
+      case AllocationOp::DO_RESIZE:
+      {
+        const AllocationResizeInfo& resize_info = *static_cast<const AllocationResizeInfo*>(ptr);
+
+        return ResizeInPlace(allocator, resize_info.ptr, resize_info.old_size, size, alignment, resize_info.source_info);
+      }
+      case AllocationOp::DO_ALLOCATE_BATCH:
+      {
+        AllocationBatchInfo& batch_info = *static_cast<AllocationBatchInfo*>(ptr);
+
+        batch_info.num_allocated = AllocateBatchOrLoop(allocator, batch_info.ptrs, batch_info.num_ptrs, size, alignment, batch_info.source_info);
+        break;
+      }
+      case AllocationOp::DO_DEALLOCATE_BATCH:
+      {
+        const AllocationBatchInfo& batch_info = *static_cast<const AllocationBatchInfo*>(ptr);
+
+        DeallocateBatchOrLoop(allocator, batch_info.ptrs, batch_info.num_ptrs, size, alignment);
+        break;
+      }
+      case AllocationOp::DO_QUERY_STATS:
+      {
+        AllocatorStats* const stats = static_cast<AllocatorStats*>(ptr);
+
+        if (QueryStatsIfSupported(allocator, *stats))
+        {
+          return AllocationResult{stats, sizeof(AllocatorStats)};
+        }
+        break;
+      }
+    }
+
+    return AllocationResult::Null();
+  }
+}  // namespace Memory
+
 /*!
  * @brief
  *   Type erased polymorphic allocator, unlike AllocatorView this in meant for long term storage.
@@ -225,6 +522,31 @@ struct IPolymorphicAllocator
   {
     allocate_fn(size, alignment, ptr, AllocationOp::DO_DEALLOCATE, this);
   }
+
+  AllocationResult Resize(void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+  {
+    AllocationResizeInfo resize_info{ptr, old_size, source_info};
+    return allocate_fn(new_size, alignment, &resize_info, AllocationOp::DO_RESIZE, this);
+  }
+
+  MemoryIndex AllocateBatch(void** const out_ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+  {
+    AllocationBatchInfo batch_info{out_ptrs, num_ptrs, 0u, source_info};
+    allocate_fn(size, alignment, &batch_info, AllocationOp::DO_ALLOCATE_BATCH, this);
+    return batch_info.num_allocated;
+  }
+
+  void DeallocateBatch(void* const* const ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment) noexcept
+  {
+    AllocationBatchInfo batch_info{const_cast<void**>(ptrs), num_ptrs, 0u, MemoryMakeAllocationSourceInfo()};
+    allocate_fn(size, alignment, &batch_info, AllocationOp::DO_DEALLOCATE_BATCH, this);
+  }
+
+  bool QueryStats(AllocatorStats& out_stats) noexcept
+  {
+    out_stats = {};
+    return allocate_fn(0u, 0u, &out_stats, AllocationOp::DO_QUERY_STATS, this).ptr != nullptr;
+  }
 };
 
 /*!
@@ -265,21 +587,35 @@ struct AllocatorView
     allocate_fn(size, alignment, ptr, AllocationOp::DO_DEALLOCATE, self);
   }
 
-  template<typename AllocatorConcept>
-  static AllocationResult AllocateImpl(MemoryIndex size, MemoryIndex alignment, void* const ptr, const AllocationOp op, void* const self)
+  AllocationResult Resize(void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) const noexcept
   {
-    AllocatorConcept& typed_self = *static_cast<AllocatorConcept*>(self);
+    AllocationResizeInfo resize_info{ptr, old_size, source_info};
+    return allocate_fn(new_size, alignment, &resize_info, AllocationOp::DO_RESIZE, self);
+  }
 
-    if (op == AllocationOp::DO_ALLOCATE)
-    {
-      return typed_self.Allocate(size, alignment, *static_cast<const AllocationSourceInfo*>(ptr));
-    }
-    else
-    {
-      typed_self.Deallocate(ptr, size, alignment);
-    }
+  MemoryIndex AllocateBatch(void** const out_ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) const noexcept
+  {
+    AllocationBatchInfo batch_info{out_ptrs, num_ptrs, 0u, source_info};
+    allocate_fn(size, alignment, &batch_info, AllocationOp::DO_ALLOCATE_BATCH, self);
+    return batch_info.num_allocated;
+  }
 
-    return AllocationResult::Null();
+  void DeallocateBatch(void* const* const ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment) const noexcept
+  {
+    AllocationBatchInfo batch_info{const_cast<void**>(ptrs), num_ptrs, 0u, MemoryMakeAllocationSourceInfo()};
+    allocate_fn(size, alignment, &batch_info, AllocationOp::DO_DEALLOCATE_BATCH, self);
+  }
+
+  bool QueryStats(AllocatorStats& out_stats) const noexcept
+  {
+    out_stats = {};
+    return allocate_fn(0u, 0u, &out_stats, AllocationOp::DO_QUERY_STATS, self).ptr != nullptr;
+  }
+
+  template<typename AllocatorConcept>
+  static AllocationResult AllocateImpl(MemoryIndex size, MemoryIndex alignment, void* const ptr, const AllocationOp op, void* const self)
+  {
+    return Memory::PolymorphicAllocatorDispatch(*static_cast<AllocatorConcept*>(self), size, alignment, ptr, op);
   }
 };
 
@@ -289,16 +625,17 @@ enum class AllocationMarkPolicy : bool
   MARKED   = true,
 };
 
-enum class BoundCheckingPolicy : bool
+enum class BoundCheckingPolicy : unsigned char
 {
-  UNCHECKED = false,
-  CHECKED   = true,
+  UNCHECKED       = 0u,
+  CHECKED         = 1u,  //!< Size header, front and back guards are each `alignment` bytes.
+  CHECKED_COMPACT = 2u,  //!< Size header packed with the front guard into one aligned prefix and a fixed `CompactGuardSize` back guard.
 };
 
 struct MemoryTrackAllocate
 {
   AllocationResult     allocation;
-  MemoryIndex          requested_bytes;
+  MemoryIndex          requested_bytes;  //!< Includes any bookkeeping, the matching `MemoryTrackDeallocate::num_bytes` will be the same.
   MemoryIndex          alignment;
   AllocationSourceInfo source_info;
 };
@@ -319,27 +656,105 @@ namespace Memory
   static constexpr byte AllocatedBytePattern = 0xCD;
   static constexpr byte FreeBytePattern      = 0xDD;
 
+  static constexpr MemoryIndex CompactGuardSize = 8u;  //!< Minimum guard bytes on each side of a `CHECKED_COMPACT` allocation.
+
+  /*!
+   * @brief
+   *   Where the bookkeeping `Allocator<>` adds around a user allocation lives.
+   *
+   *   [size header][front guard][user memory][back guard]
+   *   |<------ header_size ---->|
+   */
+  struct GuardLayout
+  {
+    MemoryIndex alignment;         //!< Alignment passed to the base allocator.
+    MemoryIndex header_size;       //!< Bytes from the base allocation to the user memory, a multiple of `alignment`.
+    MemoryIndex front_guard_size;  //!< Guard bytes directly before the user memory.
+    MemoryIndex back_guard_size;   //!< Guard bytes directly after the user memory.
+
+    MemoryIndex TotalSize(const MemoryIndex user_size) const noexcept { return header_size + user_size + back_guard_size; }
+  };
+
   template<BoundCheckingPolicy BoundCheck>
-  void GuardBytes(byte* const bytes, const MemoryIndex num_bytes) noexcept
+  GuardLayout MakeGuardLayout(MemoryIndex alignment) noexcept
   {
-    if constexpr (BoundCheck == BoundCheckingPolicy::CHECKED)
+    if constexpr (BoundCheck == BoundCheckingPolicy::UNCHECKED)
     {
-      for (MemoryIndex byte_index = 0u; byte_index < num_bytes; ++byte_index)
+      return GuardLayout{alignment, 0u, 0u, 0u};
+    }
+    else
+    {
+      if (alignment < alignof(MemoryIndex))
       {
-        bytes[byte_index] = GuardBytePattern;
+        alignment = alignof(MemoryIndex);
+      }
+
+      if constexpr (BoundCheck == BoundCheckingPolicy::CHECKED_COMPACT)
+      {
+        // Whatever padding the alignment forces after the size header all becomes front guard.
+        const MemoryIndex header_size = (sizeof(MemoryIndex) + CompactGuardSize + alignment - 1u) & ~(alignment - 1u);
+
+        return GuardLayout{alignment, header_size, header_size - sizeof(MemoryIndex), CompactGuardSize};
+      }
+      else
+      {
+        return GuardLayout{alignment, alignment + alignment, alignment, alignment};
       }
     }
   }
 
+  /*!
+   * @brief
+   *   Sets `num_bytes` of `bytes` to `pattern`, goes through `memset` so it gets the
+   *   platform's vectorized implementation.
+   */
+  void FillBytePattern(byte* const bytes, const MemoryIndex num_bytes, const byte pattern) noexcept;
+
+  /*!
+   * @brief
+   *   Checks that every byte of `bytes` is `pattern` a vector (SSE2 / NEON) or word at a time.
+   */
+  bool IsBytePattern(const byte* const bytes, const MemoryIndex num_bytes, const byte pattern) noexcept;
+
+  /*!
+   * @brief
+   *   Fills a whole block or with `BF_MEMORY_MARK_LIMIT` only the head and tail of a large block.
+   */
+  inline void MarkBytePattern(byte* const bytes, const MemoryIndex num_bytes, const byte pattern) noexcept
+  {
+    constexpr MemoryIndex MarkLimit = BF_MEMORY_MARK_LIMIT;
+
+    if (MarkLimit != 0u && num_bytes > MarkLimit * 2u)
+    {
+      FillBytePattern(bytes, MarkLimit, pattern);
+      FillBytePattern(bytes + num_bytes - MarkLimit, MarkLimit, pattern);
+    }
+    else
+    {
+      FillBytePattern(bytes, num_bytes, pattern);
+    }
+  }
+
+  template<BoundCheckingPolicy BoundCheck>
+  void GuardBytes(byte* const bytes, const MemoryIndex num_bytes) noexcept
+  {
+    if constexpr (BoundCheck != BoundCheckingPolicy::UNCHECKED)
+    {
+      FillBytePattern(bytes, num_bytes, GuardBytePattern);
+    }
+  }
+
   template<BoundCheckingPolicy BoundCheck>
   void CheckGuardBytes(const byte* const bytes, const MemoryIndex num_bytes) noexcept
   {
-    if constexpr (BoundCheck == BoundCheckingPolicy::CHECKED)
+    if constexpr (BoundCheck != BoundCheckingPolicy::UNCHECKED)
     {
-      for (MemoryIndex byte_index = 0u; byte_index < num_bytes; ++byte_index)
-      {
-        bfMemAssert(bytes[byte_index] == GuardBytePattern, "Memory guard byte check failure.");
-      }
+#if BF_MEMORY_ASSERTIONS
+      bfMemAssert(IsBytePattern(bytes, num_bytes, GuardBytePattern), "Memory guard byte check failure.");
+#else
+      (void)bytes;
+      (void)num_bytes;
+#endif
     }
   }
 
@@ -348,10 +763,7 @@ namespace Memory
   {
     if constexpr (MarkPolicy == AllocationMarkPolicy::MARKED)
     {
-      for (MemoryIndex byte_index = 0u; byte_index < num_bytes; ++byte_index)
-      {
-        bytes[byte_index] = AllocatedBytePattern;
-      }
+      MarkBytePattern(bytes, num_bytes, AllocatedBytePattern);
     }
   }
 
@@ -360,10 +772,7 @@ namespace Memory
   {
     if constexpr (MarkPolicy == AllocationMarkPolicy::MARKED)
     {
-      for (MemoryIndex byte_index = 0u; byte_index < num_bytes; ++byte_index)
-      {
-        bytes[byte_index] = FreeBytePattern;
-      }
+      MarkBytePattern(bytes, num_bytes, FreeBytePattern);
     }
   }
 
@@ -392,12 +801,14 @@ namespace Memory
  *
  * @tparam LockPolicy
  *   Will call `LockPolicy::Lock` and `LockPolicy::Unlock` around any allocation or allocation tracking operation.
+ *   See "lock_policies.hpp" for the thread-safe policies.
  *
  * @tparam MarkPolicy
  *   Whether or not to mark each allocation and deallocation with special byte patterns.
  *
  * @tparam BoundCheck
- *   Whether or not to add extra guard bytes for detecting heap corruption.
+ *   Whether or not to add extra guard bytes for detecting heap corruption,
+ *   `CHECKED_COMPACT` keeps the overhead small for large alignments.
  */
 template<typename BaseAllocator,
          AllocationMarkPolicy MarkPolicy   = Memory::DefaultMarkPolicy,
@@ -414,23 +825,18 @@ struct Allocator : public IPolymorphicAllocator,
   static constexpr bool MemoryMarkingEnabled = MarkPolicy != AllocationMarkPolicy::UNMARKED;
   static constexpr bool BoundCheckingEnabled = BoundCheck != BoundCheckingPolicy::UNCHECKED;
 
+  // Without the size header a tracked allocation must come back with the size it was tracked with,
+  // so extra bytes from the base allocator are not handed out.
+  static constexpr bool HandsOutExtraBytes = BoundCheckingEnabled || std::is_same_v<AllocationTrackingPolicy, Memory::NoMemoryTracking>;
+
   template<typename... Args>
   Allocator(Args&&... args) :
     IPolymorphicAllocator(+[](MemoryIndex size, MemoryIndex alignment, void* const ptr, const AllocationOp op, void* const self) -> AllocationResult {
       // Polymorphic Interface
 
-      Allocator<BaseAllocator>& typed_self = *static_cast<Allocator<BaseAllocator>*>(static_cast<IPolymorphicAllocator*>(self));
-
-      if (op == AllocationOp::DO_ALLOCATE)
-      {
-        return typed_self.Allocate(size, alignment, *static_cast<const AllocationSourceInfo*>(ptr));
-      }
-      else
-      {
-        typed_self.Deallocate(ptr, size, alignment);
-      }
+      Allocator& typed_self = *static_cast<Allocator*>(static_cast<IPolymorphicAllocator*>(self));
 
-      return AllocationResult::Null();
+      return Memory::PolymorphicAllocatorDispatch(typed_self, size, alignment, ptr, op);
     }),
     BaseAllocator{static_cast<decltype(args)&&>(args)...}
   {
@@ -438,48 +844,30 @@ struct Allocator : public IPolymorphicAllocator,
 
   // Static Interface
 
-  AllocationResult Allocate(const MemoryIndex size, MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+  AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
   {
-    if constexpr (BoundCheckingEnabled)
-    {
-      if (alignment < alignof(MemoryIndex))
-      {
-        alignment = alignof(MemoryIndex);
-      }
-    }
-
-    const MemoryIndex guard_size = BoundCheckingEnabled ? alignment : 0u;
-    const MemoryIndex total_size = guard_size + guard_size + size + guard_size;
+    const Memory::GuardLayout layout     = Memory::MakeGuardLayout<BoundCheck>(alignment);
+    const MemoryIndex         total_size = layout.TotalSize(size);
 
     LockPolicy::Lock();
 
-    const AllocationResult allocation = static_cast<BaseAllocator*>(this)->Allocate(total_size, alignment, source_info);
+    const AllocationResult allocation       = static_cast<BaseAllocator*>(this)->Allocate(total_size, layout.alignment, source_info);
+    const MemoryIndex      user_memory_size = allocation && HandsOutExtraBytes ? size + (allocation.num_bytes - total_size) : size;
 
     if (allocation)
     {
-      AllocationTrackingPolicy::TrackAllocate(MemoryTrackAllocate{allocation, total_size, alignment, source_info});
+      AllocationTrackingPolicy::TrackAllocate(MemoryTrackAllocate{allocation, layout.TotalSize(user_memory_size), layout.alignment, source_info});
     }
 
     LockPolicy::Unlock();
 
     if (allocation)
     {
-      const MemoryIndex extra_bytes       = allocation.num_bytes - total_size;
-      byte* const       bytes             = static_cast<byte*>(allocation.ptr);
-      const MemoryIndex user_memory_size  = size + extra_bytes;
-      byte* const       size_header       = bytes;
-      byte* const       guard_bytes_front = size_header + guard_size;
-      byte* const       mark_bytes        = guard_bytes_front + guard_size;
-      byte* const       guard_bytes_back  = mark_bytes + user_memory_size;
-
-      if constexpr (BoundCheckingEnabled)
-      {
-        *reinterpret_cast<MemoryIndex*>(size_header) = user_memory_size;
-      }
+      byte* const bytes      = static_cast<byte*>(allocation.ptr);
+      byte* const mark_bytes = bytes + layout.header_size;
 
-      Memory::GuardBytes<BoundCheck>(guard_bytes_front, guard_size);
+      WriteGuards(layout, mark_bytes, user_memory_size);
       Memory::MarkAllocatedBytes<MarkPolicy>(mark_bytes, user_memory_size);
-      Memory::GuardBytes<BoundCheck>(guard_bytes_back, guard_size);
 
       return AllocationResult(mark_bytes, user_memory_size);
     }
@@ -487,43 +875,229 @@ struct Allocator : public IPolymorphicAllocator,
     return AllocationResult::Null();
   }
 
-  void Deallocate(void* const ptr, const MemoryIndex size, MemoryIndex alignment) noexcept
+  void Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
   {
     if (ptr)
     {
-      if constexpr (BoundCheckingEnabled)
+      const Memory::GuardLayout layout           = Memory::MakeGuardLayout<BoundCheck>(alignment);
+      byte* const               mark_bytes       = static_cast<byte*>(ptr);
+      const MemoryIndex         user_memory_size = UserMemorySize(layout, mark_bytes, size);
+      const MemoryIndex         total_size       = layout.TotalSize(user_memory_size);
+      byte* const               bytes            = mark_bytes - layout.header_size;
+
+      CheckGuards(layout, mark_bytes);
+      Memory::MarkFreedBytes<MarkPolicy>(mark_bytes, user_memory_size);
+
+      LockPolicy::Lock();
+      {
+        AllocationTrackingPolicy::TrackDeallocate(MemoryTrackDeallocate{bytes, total_size, layout.alignment});
+        static_cast<BaseAllocator*>(this)->Deallocate(bytes, total_size, layout.alignment);
+      }
+      LockPolicy::Unlock();
+    }
+  }
+
+  AllocationResult Resize(void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+  {
+    if constexpr (Memory::HasResizeOp_v<BaseAllocator>)
+    {
+      if (ptr && new_size != 0u)
       {
-        if (alignment < alignof(MemoryIndex))
+        const Memory::GuardLayout layout         = Memory::MakeGuardLayout<BoundCheck>(alignment);
+        byte* const               mark_bytes     = static_cast<byte*>(ptr);
+        const MemoryIndex         old_total_size = layout.TotalSize(UserMemorySize(layout, mark_bytes, old_size));
+        const MemoryIndex         new_total_size = layout.TotalSize(new_size);
+        byte* const               bytes          = mark_bytes - layout.header_size;
+
+        CheckGuards(layout, mark_bytes);
+
+        LockPolicy::Lock();
+
+        const AllocationResult allocation       = static_cast<BaseAllocator*>(this)->Resize(bytes, old_total_size, new_total_size, layout.alignment, source_info);
+        const MemoryIndex      user_memory_size = allocation && HandsOutExtraBytes ? new_size + (allocation.num_bytes - new_total_size) : new_size;
+
+        if (allocation)
         {
-          alignment = alignof(MemoryIndex);
+          AllocationTrackingPolicy::TrackDeallocate(MemoryTrackDeallocate{bytes, old_total_size, layout.alignment});
+          AllocationTrackingPolicy::TrackAllocate(MemoryTrackAllocate{allocation, layout.TotalSize(user_memory_size), layout.alignment, source_info});
+        }
+
+        LockPolicy::Unlock();
+
+        if (allocation)
+        {
+          if (user_memory_size > old_size)
+          {
+            Memory::MarkAllocatedBytes<MarkPolicy>(mark_bytes + old_size, user_memory_size - old_size);
+          }
+
+          WriteGuards(layout, mark_bytes, user_memory_size);
+
+          return AllocationResult(mark_bytes, user_memory_size);
         }
       }
 
-      const MemoryIndex guard_size        = BoundCheckingEnabled ? alignment : 0u;
-      const MemoryIndex total_size        = guard_size + guard_size + size + guard_size;
-      byte* const       bytes             = static_cast<byte*>(ptr) - guard_size - guard_size;
-      byte* const       size_header       = bytes;
-      byte* const       guard_bytes_front = size_header + guard_size;
-      byte* const       mark_bytes        = guard_bytes_front + guard_size;
+      return AllocationResult::Null();
+    }
+    else
+    {
+      return Memory::ResizeInPlace(*static_cast<BaseAllocator*>(this), ptr, old_size, new_size, alignment, source_info);
+    }
+  }
+
+  // The lock is only taken once for the whole batch.
+
+  MemoryIndex AllocateBatch(void** const out_ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+  {
+    if (size == 0u || num_ptrs == 0u)
+    {
+      return 0u;
+    }
+
+    const Memory::GuardLayout layout     = Memory::MakeGuardLayout<BoundCheck>(alignment);
+    const MemoryIndex         total_size = layout.TotalSize(size);
+
+    LockPolicy::Lock();
 
-      if constexpr (BoundCheckingEnabled)
+    const MemoryIndex num_allocated = Memory::AllocateBatchOrLoop(*static_cast<BaseAllocator*>(this), out_ptrs, num_ptrs, total_size, layout.alignment, source_info);
+
+    for (MemoryIndex index = 0u; index < num_allocated; ++index)
+    {
+      AllocationTrackingPolicy::TrackAllocate(MemoryTrackAllocate{AllocationResult(out_ptrs[index], total_size), total_size, layout.alignment, source_info});
+    }
+
+    LockPolicy::Unlock();
+
+    if constexpr (MemoryMarkingEnabled || BoundCheckingEnabled)
+    {
+      for (MemoryIndex index = 0u; index < num_allocated; ++index)
       {
-        const MemoryIndex user_memory_size = *reinterpret_cast<const MemoryIndex*>(size_header);
-        byte* const       guard_bytes_back = mark_bytes + user_memory_size;
+        byte* const mark_bytes = static_cast<byte*>(out_ptrs[index]) + layout.header_size;
+
+        WriteGuards(layout, mark_bytes, size);
+        Memory::MarkAllocatedBytes<MarkPolicy>(mark_bytes, size);
 
-        Memory::CheckGuardBytes<BoundCheck>(guard_bytes_front, guard_size);
-        Memory::CheckGuardBytes<BoundCheck>(guard_bytes_back, guard_size);
+        out_ptrs[index] = mark_bytes;
       }
+    }
 
-      Memory::MarkFreedBytes<MarkPolicy>(mark_bytes, size);
+    return num_allocated;
+  }
+
+  void DeallocateBatch(void* const* const ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment) noexcept
+  {
+    const Memory::GuardLayout layout = Memory::MakeGuardLayout<BoundCheck>(alignment);
 
+    if constexpr (BoundCheckingEnabled)
+    {
+      // Each pointer has its own handed out size in its header and the base pointers
+      // are not in a contiguous array so each one is given back separately.
       LockPolicy::Lock();
       {
-        AllocationTrackingPolicy::TrackDeallocate(MemoryTrackDeallocate{bytes, total_size, alignment});
-        static_cast<BaseAllocator*>(this)->Deallocate(bytes, total_size, alignment);
+        for (MemoryIndex index = 0u; index < num_ptrs; ++index)
+        {
+          byte* const       mark_bytes       = static_cast<byte*>(ptrs[index]);
+          const MemoryIndex user_memory_size = UserMemorySize(layout, mark_bytes, size);
+          const MemoryIndex total_size       = layout.TotalSize(user_memory_size);
+          byte* const       bytes            = mark_bytes - layout.header_size;
+
+          CheckGuards(layout, mark_bytes);
+          Memory::MarkFreedBytes<MarkPolicy>(mark_bytes, user_memory_size);
+
+          AllocationTrackingPolicy::TrackDeallocate(MemoryTrackDeallocate{bytes, total_size, layout.alignment});
+          static_cast<BaseAllocator*>(this)->Deallocate(bytes, total_size, layout.alignment);
+        }
       }
       LockPolicy::Unlock();
     }
+    else
+    {
+      const MemoryIndex total_size = layout.TotalSize(size);
+
+      for (MemoryIndex index = 0u; index < num_ptrs; ++index)
+      {
+        Memory::MarkFreedBytes<MarkPolicy>(static_cast<byte*>(ptrs[index]), size);
+      }
+
+      LockPolicy::Lock();
+      {
+        for (MemoryIndex index = 0u; index < num_ptrs; ++index)
+        {
+          AllocationTrackingPolicy::TrackDeallocate(MemoryTrackDeallocate{static_cast<byte*>(ptrs[index]), total_size, layout.alignment});
+        }
+
+        Memory::DeallocateBatchOrLoop(*static_cast<BaseAllocator*>(this), ptrs, num_ptrs, total_size, layout.alignment);
+      }
+      LockPolicy::Unlock();
+    }
+  }
+
+  /*!
+   * @brief
+   *   Stats of the `BaseAllocator` so the bounds checking guards count as used memory.
+   *
+   * @return
+   *   false if the `BaseAllocator` does not implement `QueryStats`.
+   */
+  bool QueryStats(AllocatorStats& out_stats) noexcept
+  {
+    LockPolicy::Lock();
+    const bool has_stats = Memory::QueryStatsIfSupported(*static_cast<BaseAllocator*>(this), out_stats);
+    LockPolicy::Unlock();
+
+    return has_stats;
+  }
+
+ private:
+  // The size header lets the back guard be found on free since the user size passed in may be less than what was allocated.
+
+  static void WriteGuards(const Memory::GuardLayout& layout, byte* const mark_bytes, const MemoryIndex user_memory_size) noexcept
+  {
+    if constexpr (BoundCheckingEnabled)
+    {
+      *reinterpret_cast<MemoryIndex*>(mark_bytes - layout.header_size) = user_memory_size;
+
+      Memory::GuardBytes<BoundCheck>(mark_bytes - layout.front_guard_size, layout.front_guard_size);
+      Memory::GuardBytes<BoundCheck>(mark_bytes + user_memory_size, layout.back_guard_size);
+    }
+    else
+    {
+      (void)layout;
+      (void)mark_bytes;
+      (void)user_memory_size;
+    }
+  }
+
+  // What the caller was handed, the size header is read back since the size passed in may be less.
+  static MemoryIndex UserMemorySize(const Memory::GuardLayout& layout, const byte* const mark_bytes, const MemoryIndex size) noexcept
+  {
+    if constexpr (BoundCheckingEnabled)
+    {
+      (void)size;
+      return *reinterpret_cast<const MemoryIndex*>(mark_bytes - layout.header_size);
+    }
+    else
+    {
+      (void)layout;
+      (void)mark_bytes;
+      return size;
+    }
+  }
+
+  static void CheckGuards(const Memory::GuardLayout& layout, const byte* const mark_bytes) noexcept
+  {
+    if constexpr (BoundCheckingEnabled)
+    {
+      const MemoryIndex user_memory_size = *reinterpret_cast<const MemoryIndex*>(mark_bytes - layout.header_size);
+
+      Memory::CheckGuardBytes<BoundCheck>(mark_bytes - layout.front_guard_size, layout.front_guard_size);
+      Memory::CheckGuardBytes<BoundCheck>(mark_bytes + user_memory_size, layout.back_guard_size);
+    }
+    else
+    {
+      (void)layout;
+      (void)mark_bytes;
+    }
   }
 };
 
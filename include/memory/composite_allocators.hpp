@@ -0,0 +1,354 @@
+/******************************************************************************/
+/*!
+ * @file   composite_allocators.hpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Adaptors for building allocator hierarchies out of the other allocators,
+ *   falling back to another allocator on failure and capping memory use with
+ *   per subsystem budgets.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#ifndef LIB_FOUNDATION_MEMORY_COMPOSITE_ALLOCATORS_HPP
+#define LIB_FOUNDATION_MEMORY_COMPOSITE_ALLOCATORS_HPP
+
+#include "alignment.hpp"    // CacheLineSize
+#include "basic_types.hpp"  // AllocationResult, MemoryIndex, IPolymorphicAllocator
+
+#include <atomic>       // atomic
+#include <type_traits>  // false_type, true_type, void_t, enable_if_t
+#include <utility>      // forward, declval
+
+namespace Memory
+{
+  //-------------------------------------------------------------------------------------//
+  // Memory Budget
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   A byte limit that can be nested under a parent budget, a charge must fit
+   *   in this budget and every one of its parents to succeed.
+   *
+   *   The counters are relaxed atomics so a budget can be shared between
+   *   threads and allocators, a charge is one `fetch_add` per level.
+   *   Near the limit concurrent charges may briefly overshoot and then roll back,
+   *   so a charge can fail that would have fit with the threads serialized
+   *   but the committed total never exceeds the limit.
+   *
+   *   A budget must outlive everything charged to it.
+   */
+  class alignas(CacheLineSize) MemoryBudget
+  {
+   public:
+    static constexpr MemoryIndex Unlimited = MemoryIndex(-1);  //!< Just counts, for a parent that only aggregates its children.
+
+   private:
+    const char*              m_Name;
+    MemoryBudget*            m_Parent;
+    std::atomic<MemoryIndex> m_Limit;
+    std::atomic<MemoryIndex> m_UsedBytes;
+    std::atomic<MemoryIndex> m_PeakBytes;
+    std::atomic<MemoryIndex> m_NumFailedCharges;  //!< Charges that failed because of this level.
+
+   public:
+    MemoryBudget(const char* const name, const MemoryIndex limit, MemoryBudget* const parent = nullptr) noexcept;
+
+    MemoryBudget(const MemoryBudget& rhs)            = delete;
+    MemoryBudget(MemoryBudget&& rhs)                 = delete;
+    MemoryBudget& operator=(const MemoryBudget& rhs) = delete;
+    MemoryBudget& operator=(MemoryBudget&& rhs)      = delete;
+
+    const char*   Name() const noexcept { return m_Name; }
+    MemoryBudget* Parent() const noexcept { return m_Parent; }
+    MemoryIndex   Limit() const noexcept { return m_Limit.load(std::memory_order_relaxed); }
+    MemoryIndex   UsedBytes() const noexcept { return m_UsedBytes.load(std::memory_order_relaxed); }
+    MemoryIndex   PeakBytes() const noexcept { return m_PeakBytes.load(std::memory_order_relaxed); }
+    MemoryIndex   NumFailedCharges() const noexcept { return m_NumFailedCharges.load(std::memory_order_relaxed); }
+
+    /*!
+     * @brief
+     *   Lowering the limit below `UsedBytes` does not free anything,
+     *   new charges just fail until enough memory has been released.
+     */
+    void SetLimit(const MemoryIndex limit) noexcept { m_Limit.store(limit, std::memory_order_relaxed); }
+
+    /*!
+     * @brief
+     *   Adds \p size bytes to this budget and all of its parents.
+     *
+     * @return
+     *   false, with nothing charged, if any level would go over its limit.
+     */
+    bool TryCharge(const MemoryIndex size) noexcept;
+
+    /*!
+     * @brief
+     *   Gives back bytes from a successful `TryCharge` to this budget and all of its parents.
+     */
+    void Release(const MemoryIndex size) noexcept;
+
+   private:
+    bool TryChargeLocal(const MemoryIndex size) noexcept;
+    void ReleaseLocal(const MemoryIndex size) noexcept;
+  };
+
+  //-------------------------------------------------------------------------------------//
+  // Budgeted Allocator
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   Whether or not an allocator can tell if it owns a pointer with
+   *   `bool IsPtrInRange(const void* ptr) const`.
+   */
+  template<typename AllocatorConcept, typename = void>
+  struct HasIsPtrInRangeOp : public std::false_type
+  {
+  };
+
+  template<typename AllocatorConcept>
+  struct HasIsPtrInRangeOp<AllocatorConcept, std::void_t<decltype(std::declval<const AllocatorConcept&>().IsPtrInRange(std::declval<const void*>()))>> : public std::true_type
+  {
+  };
+
+  template<typename AllocatorConcept>
+  inline constexpr bool HasIsPtrInRangeOp_v = HasIsPtrInRangeOp<AllocatorConcept>::value;
+
+  /*!
+   * @brief
+   *   Charges the requested size of every allocation from \p BaseAllocator to a `MemoryBudget`,
+   *   over budget requests fail before ever reaching the base allocator.
+   *
+   *   Only the requested size is handed out, extra bytes from the base allocator are
+   *   not, so the size given to `Deallocate` is always the size that was charged.
+   *   Calling `Clear` on the base directly does not release anything.
+   *
+   *   ```
+   *   MemoryBudget                                   heap_budget{"Heap", bfMegabytes(256)};
+   *   Allocator<BudgetedAllocator<AllocatorView>>    budgeted_heap{heap_budget, DefaultHeap()};
+   *   ```
+   *
+   * @tparam BaseAllocator
+   *   The allocator memory is actually requested from, `AllocatorView` to budget an existing `IPolymorphicAllocator`.
+   */
+  template<typename BaseAllocator>
+  class BudgetedAllocator
+  {
+   private:
+    BaseAllocator m_Allocator;
+    MemoryBudget& m_Budget;
+
+   public:
+    template<typename... Args>
+    BudgetedAllocator(MemoryBudget& budget, Args&&... args) :
+      m_Allocator(std::forward<Args>(args)...),
+      m_Budget{budget}
+    {
+    }
+
+    BudgetedAllocator(const BudgetedAllocator& rhs)            = delete;
+    BudgetedAllocator(BudgetedAllocator&& rhs)                 = delete;
+    BudgetedAllocator& operator=(const BudgetedAllocator& rhs) = delete;
+    BudgetedAllocator& operator=(BudgetedAllocator&& rhs)      = delete;
+
+    BaseAllocator&       Base() noexcept { return m_Allocator; }
+    const BaseAllocator& Base() const noexcept { return m_Allocator; }
+    MemoryBudget&        Budget() const noexcept { return m_Budget; }
+
+    template<typename T = BaseAllocator, typename = std::enable_if_t<HasIsPtrInRangeOp_v<T>>>
+    bool IsPtrInRange(const void* const ptr) const noexcept
+    {
+      return m_Allocator.IsPtrInRange(ptr);
+    }
+
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+    {
+      if (!m_Budget.TryCharge(size))
+      {
+        return AllocationResult::Null();
+      }
+
+      const AllocationResult result = m_Allocator.Allocate(size, alignment, source_info);
+
+      if (!result)
+      {
+        m_Budget.Release(size);
+        return AllocationResult::Null();
+      }
+
+      return AllocationResult(result.ptr, size);
+    }
+
+    void Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
+    {
+      if (ptr)
+      {
+        m_Allocator.Deallocate(ptr, size, alignment);
+        m_Budget.Release(size);
+      }
+    }
+
+    AllocationResult Resize(void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+    {
+      if (new_size > old_size && !m_Budget.TryCharge(new_size - old_size))
+      {
+        return AllocationResult::Null();
+      }
+
+      const AllocationResult result = ResizeInPlace(m_Allocator, ptr, old_size, new_size, alignment, source_info);
+
+      if (!result)
+      {
+        if (new_size > old_size)
+        {
+          m_Budget.Release(new_size - old_size);
+        }
+
+        return AllocationResult::Null();
+      }
+
+      if (new_size < old_size)
+      {
+        m_Budget.Release(old_size - new_size);
+      }
+
+      return AllocationResult(result.ptr, new_size);
+    }
+
+    bool QueryStats(AllocatorStats& out_stats) noexcept
+    {
+      return QueryStatsIfSupported(m_Allocator, out_stats);
+    }
+  };
+
+  //-------------------------------------------------------------------------------------//
+  // Fallback Allocator
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   Serves allocations from \p PrimaryAllocator and only goes to the fallback
+   *   allocator when the primary fails, whether from running out of memory or
+   *   from going over a budget.
+   *
+   *   Deallocations are routed with the primary's `IsPtrInRange` so the primary
+   *   must be able to answer that for any pointer, a `GrowingPoolAllocator` needs
+   *   chunk tracking enabled.
+   *
+   *   Longer chains are built by using a wrapped `FallbackAllocator` as the
+   *   fallback of the next level up:
+   *
+   *   ```
+   *   MemoryBudget total_budget{"Total", MemoryBudget::Unlimited};
+   *   MemoryBudget shared_budget{"Shared", bfMegabytes(64), &total_budget};
+   *   MemoryBudget network_budget{"Network", bfMegabytes(4), &total_budget};
+   *
+   *   // Shared pool -> DefaultHeap
+   *   Allocator<FallbackAllocator<BudgetedAllocator<GrowingPoolAllocator>>> shared{DefaultHeap(), shared_budget, DefaultHeap(), block_size, block_alignment, num_blocks_per_chunk, true};
+   *
+   *   // Network arena -> Shared pool -> DefaultHeap
+   *   Allocator<FallbackAllocator<BudgetedAllocator<LinearAllocator>>> network{shared, network_budget, arena_memory, arena_size};
+   *   ```
+   *
+   * @tparam PrimaryAllocator
+   *   The cheaper allocator tried first, must have `IsPtrInRange`.
+   */
+  template<typename PrimaryAllocator>
+  class FallbackAllocator
+  {
+    static_assert(HasIsPtrInRangeOp_v<PrimaryAllocator>, "The primary allocator must implement `IsPtrInRange` to route deallocations.");
+
+   private:
+    PrimaryAllocator       m_Primary;
+    IPolymorphicAllocator& m_Fallback;
+
+   public:
+    template<typename... Args>
+    FallbackAllocator(IPolymorphicAllocator& fallback_allocator, Args&&... args) :
+      m_Primary(std::forward<Args>(args)...),
+      m_Fallback{fallback_allocator}
+    {
+    }
+
+    FallbackAllocator(const FallbackAllocator& rhs)            = delete;
+    FallbackAllocator(FallbackAllocator&& rhs)                 = delete;
+    FallbackAllocator& operator=(const FallbackAllocator& rhs) = delete;
+    FallbackAllocator& operator=(FallbackAllocator&& rhs)      = delete;
+
+    PrimaryAllocator&       Primary() noexcept { return m_Primary; }
+    const PrimaryAllocator& Primary() const noexcept { return m_Primary; }
+    IPolymorphicAllocator&  Fallback() const noexcept { return m_Fallback; }
+
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+    {
+      const AllocationResult result = m_Primary.Allocate(size, alignment, source_info);
+
+      if (result)
+      {
+        return result;
+      }
+
+      return m_Fallback.Allocate(size, alignment, source_info);
+    }
+
+    void Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
+    {
+      if (m_Primary.IsPtrInRange(ptr))
+      {
+        m_Primary.Deallocate(ptr, size, alignment);
+      }
+      else
+      {
+        m_Fallback.Deallocate(ptr, size, alignment);
+      }
+    }
+
+    // Only resizes in place, an allocation never moves between the primary and the fallback.
+    AllocationResult Resize(void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+    {
+      if (m_Primary.IsPtrInRange(ptr))
+      {
+        return ResizeInPlace(m_Primary, ptr, old_size, new_size, alignment, source_info);
+      }
+
+      return m_Fallback.Resize(ptr, old_size, new_size, alignment, source_info);
+    }
+
+    // Stats of the primary allocator, the fallback is shared so it is not included.
+    bool QueryStats(AllocatorStats& out_stats) noexcept
+    {
+      return QueryStatsIfSupported(m_Primary, out_stats);
+    }
+  };
+}  // namespace Memory
+
+#endif  // LIB_FOUNDATION_MEMORY_COMPOSITE_ALLOCATORS_HPP
+
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
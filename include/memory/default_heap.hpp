@@ -21,6 +21,10 @@
 #define BF_MEMORY_DEBUG_HEAP 1  //!< The default heap allocator will have debug checks.
 #endif
 
+#ifndef BF_MEMORY_THREAD_CACHED_HEAP
+#define BF_MEMORY_THREAD_CACHED_HEAP 1  //!< The default heap allocator will serve small allocations from per-thread caches.
+#endif
+
 #if !BF_MEMORY_NO_DEFAULT_HEAP
 namespace Memory
 {
@@ -0,0 +1,400 @@
+/******************************************************************************/
+/*!
+ * @file   deferred_free.hpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Ways to free memory from a thread other than the one allowed to call
+ *   `Deallocate`, either by handing it back to the owning thread or by
+ *   waiting until no lock-free reader can still be using it.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#ifndef LIB_FOUNDATION_MEMORY_DEFERRED_FREE_HPP
+#define LIB_FOUNDATION_MEMORY_DEFERRED_FREE_HPP
+
+#include "alignment.hpp"    // CacheLineSize
+#include "array.hpp"        // Array
+#include "basic_types.hpp"  // AllocationResult, MemoryIndex, IPolymorphicAllocator
+
+#include <atomic>   // atomic
+#include <cstdint>  // uint64_t
+#include <mutex>    // mutex
+#include <thread>   // thread::id, this_thread::get_id
+#include <utility>  // forward
+
+namespace Memory
+{
+  //-------------------------------------------------------------------------------------//
+  // Remote Free List
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   Written into a block while it waits in a `RemoteFreeList`.
+   */
+  struct RemoteFreeBlock
+  {
+    static constexpr unsigned int AlignmentShift = 56u;  //!< The top byte of `size_and_alignment` is log2 of the alignment.
+
+    RemoteFreeBlock* next;
+    MemoryIndex      size_and_alignment;
+
+    MemoryIndex Size() const noexcept { return size_and_alignment & ((MemoryIndex(1u) << AlignmentShift) - 1u); }
+    MemoryIndex Alignment() const noexcept { return MemoryIndex(1u) << (size_and_alignment >> AlignmentShift); }
+  };
+
+  /*!
+   * @brief
+   *   Lock-free multiple producer single consumer list of freed blocks.
+   *
+   *   Any thread can `Push` a block, the single owner takes the whole list
+   *   with one exchange so there is no ABA problem to worry about.
+   */
+  class alignas(CacheLineSize) RemoteFreeList
+  {
+   public:
+    static constexpr MemoryIndex MinBlockSize      = sizeof(RemoteFreeBlock);   //!< Blocks must be able to hold a `RemoteFreeBlock`.
+    static constexpr MemoryIndex MinBlockAlignment = alignof(RemoteFreeBlock);
+
+   private:
+    std::atomic<RemoteFreeBlock*> m_Head;
+
+   public:
+    RemoteFreeList() noexcept :
+      m_Head{nullptr}
+    {
+    }
+
+    RemoteFreeList(const RemoteFreeList& rhs)            = delete;
+    RemoteFreeList(RemoteFreeList&& rhs)                 = delete;
+    RemoteFreeList& operator=(const RemoteFreeList& rhs) = delete;
+    RemoteFreeList& operator=(RemoteFreeList&& rhs)      = delete;
+
+    bool IsEmpty() const noexcept { return m_Head.load(std::memory_order_relaxed) == nullptr; }
+
+    /*!
+     * @brief
+     *   Safe to call from any thread.
+     *
+     * @param ptr
+     *   Must be at least `MinBlockSize` bytes aligned to `MinBlockAlignment`.
+     */
+    void Push(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+
+    /*!
+     * @brief
+     *   Removes every pushed block, only the owner may call this.
+     */
+    RemoteFreeBlock* TakeAll() noexcept { return m_Head.exchange(nullptr, std::memory_order_acquire); }
+
+    /*!
+     * @brief
+     *   Deallocates every pushed block into \p allocator, only the owner may call this.
+     *
+     * @return
+     *   The number of blocks deallocated.
+     */
+    template<typename AllocatorConcept>
+    MemoryIndex DrainInto(AllocatorConcept& allocator) noexcept
+    {
+      MemoryIndex      num_blocks = 0u;
+      RemoteFreeBlock* block      = TakeAll();
+
+      while (block)
+      {
+        RemoteFreeBlock* const next      = block->next;
+        const MemoryIndex      size      = block->Size();
+        const MemoryIndex      alignment = block->Alignment();
+
+        allocator.Deallocate(block, size, alignment);
+        block = next;
+        ++num_blocks;
+      }
+
+      return num_blocks;
+    }
+  };
+
+  /*!
+   * @brief
+   *   Lets a single threaded allocator accept `Deallocate` from any thread.
+   *
+   *   Frees from the owning thread go straight to the base allocator, frees from any
+   *   other thread are pushed onto a `RemoteFreeList` that the owner drains at the start
+   *   of its next `Allocate` (or with `DrainRemoteFrees`). Neither path takes a lock.
+   *
+   *   Requests are rounded up to `RemoteFreeList::MinBlockSize` so every block can be queued.
+   *
+   *   When wrapped in `Allocator<>` the tracking policy is called on the freeing thread
+   *   so it must either be `NoMemoryTracking` or have a thread-safe lock policy.
+   *
+   *   ```
+   *   Allocator<RemoteFreeAllocator<PoolAllocator>, AllocationMarkPolicy::UNMARKED, BoundCheckingPolicy::UNCHECKED> pool{memory, memory_size, block_size, alignment};
+   *   ```
+   *
+   * @tparam BaseAllocator
+   *   The single threaded allocator only used by the owning thread.
+   */
+  template<typename BaseAllocator>
+  class RemoteFreeAllocator
+  {
+   private:
+    BaseAllocator   m_Allocator;
+    RemoteFreeList  m_RemoteFrees;
+    std::thread::id m_OwnerThread;
+
+   public:
+    template<typename... Args>
+    RemoteFreeAllocator(Args&&... args) :
+      m_Allocator(std::forward<Args>(args)...),
+      m_RemoteFrees{},
+      m_OwnerThread{std::this_thread::get_id()}
+    {
+    }
+
+    RemoteFreeAllocator(const RemoteFreeAllocator& rhs)            = delete;
+    RemoteFreeAllocator(RemoteFreeAllocator&& rhs)                 = delete;
+    RemoteFreeAllocator& operator=(const RemoteFreeAllocator& rhs) = delete;
+    RemoteFreeAllocator& operator=(RemoteFreeAllocator&& rhs)      = delete;
+
+    BaseAllocator&       Base() noexcept { return m_Allocator; }
+    const BaseAllocator& Base() const noexcept { return m_Allocator; }
+    bool                 IsOwnerThread() const noexcept { return std::this_thread::get_id() == m_OwnerThread; }
+
+    /*!
+     * @brief
+     *   Makes the calling thread the owner, for allocators created on one thread and used by another.
+     *   Pending remote frees are still drained into the base allocator on the next `Allocate`.
+     */
+    void BindToCurrentThread() noexcept { m_OwnerThread = std::this_thread::get_id(); }
+
+    /*!
+     * @brief
+     *   Returns every remotely freed block to the base allocator, owner thread only.
+     */
+    MemoryIndex DrainRemoteFrees() noexcept
+    {
+      bfMemAssert(IsOwnerThread(), "Only the owning thread can drain remote frees.");
+
+      return m_RemoteFrees.DrainInto(m_Allocator);
+    }
+
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+    {
+      bfMemAssert(IsOwnerThread(), "Only the owning thread can allocate.");
+
+      if (!m_RemoteFrees.IsEmpty())
+      {
+        m_RemoteFrees.DrainInto(m_Allocator);
+      }
+
+      return m_Allocator.Allocate(BlockSize(size), BlockAlignment(alignment), source_info);
+    }
+
+    void Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
+    {
+      if (ptr)
+      {
+        if (IsOwnerThread())
+        {
+          m_Allocator.Deallocate(ptr, BlockSize(size), BlockAlignment(alignment));
+        }
+        else
+        {
+          m_RemoteFrees.Push(ptr, BlockSize(size), BlockAlignment(alignment));
+        }
+      }
+    }
+
+    ~RemoteFreeAllocator() noexcept { m_RemoteFrees.DrainInto(m_Allocator); }
+
+   private:
+    static MemoryIndex BlockSize(const MemoryIndex size) noexcept { return size < RemoteFreeList::MinBlockSize ? RemoteFreeList::MinBlockSize : size; }
+    static MemoryIndex BlockAlignment(const MemoryIndex alignment) noexcept { return alignment < RemoteFreeList::MinBlockAlignment ? RemoteFreeList::MinBlockAlignment : alignment; }
+  };
+
+  //-------------------------------------------------------------------------------------//
+  // Epoch Based Reclamation
+  //-------------------------------------------------------------------------------------//
+
+  class EpochParticipant;
+
+  /*!
+   * @brief
+   *   Memory waiting for a grace period before it can be freed.
+   */
+  struct RetiredAllocation
+  {
+    using DestroyFn = void (*)(void* const ptr);
+
+    void*                  ptr;
+    MemoryIndex            size;
+    MemoryIndex            alignment;
+    IPolymorphicAllocator* allocator;
+    DestroyFn              destroy;  //!< Optional destructor to run before deallocation.
+    std::uint64_t          epoch;    //!< The global epoch when retired.
+  };
+
+  /*!
+   * @brief
+   *   Shared state for epoch based reclamation of memory used by lock-free data structures.
+   *
+   *   Readers wrap every access in `EpochParticipant::Enter` / `Exit`. Unlinked memory is
+   *   `Retire`d rather than freed and only handed back to its allocator once the global
+   *   epoch has advanced twice, at which point no reader can still hold a pointer to it.
+   *
+   *   `Enter` and `Exit` are lock-free, the participant list lock is only taken to
+   *   register participants and when trying to advance the epoch every so many retires.
+   */
+  class EpochDomain
+  {
+    friend class EpochParticipant;
+
+   private:
+    alignas(CacheLineSize) std::atomic<std::uint64_t> m_GlobalEpoch;
+    std::mutex                                        m_Lock;          //!< Guards `m_Participants` and `m_Orphans`.
+    EpochParticipant*                                 m_Participants;
+    bf::Array<RetiredAllocation>                      m_Orphans;       //!< Left over by participants that were destroyed before their grace period.
+
+   public:
+    explicit EpochDomain(IPolymorphicAllocator& memory) noexcept;
+
+    EpochDomain(const EpochDomain& rhs)            = delete;
+    EpochDomain(EpochDomain&& rhs)                 = delete;
+    EpochDomain& operator=(const EpochDomain& rhs) = delete;
+    EpochDomain& operator=(EpochDomain&& rhs)      = delete;
+
+    std::uint64_t GlobalEpoch() const noexcept { return m_GlobalEpoch.load(std::memory_order_acquire); }
+
+    /*!
+     * @brief
+     *   Advances the global epoch if every participant inside of a critical section has seen the current one.
+     *
+     * @return
+     *   true if the epoch advanced.
+     */
+    bool TryAdvance() noexcept;
+
+    /*!
+     * @brief
+     *   All participants must be destroyed first, every orphaned allocation is freed.
+     */
+    ~EpochDomain() noexcept;
+
+   private:
+    bool TryAdvanceLocked() noexcept;
+  };
+
+  /*!
+   * @brief
+   *   A thread's registration with an `EpochDomain`, should only be used by one thread at a time.
+   *
+   *   The allocator given to `Retire` will be called from this participant's thread
+   *   so it must be thread-safe or a `RemoteFreeAllocator`.
+   */
+  class EpochParticipant
+  {
+    friend class EpochDomain;
+
+   public:
+    static constexpr MemoryIndex RetiresPerAdvance = 64u;  //!< How many retires between attempts at advancing the epoch.
+
+   private:
+    EpochDomain&                                      m_Domain;
+    EpochParticipant*                                 m_Prev;
+    EpochParticipant*                                 m_Next;
+    alignas(CacheLineSize) std::atomic<std::uint64_t> m_LocalEpoch;  //!< 0 when outside of a critical section.
+    bf::Array<RetiredAllocation>                      m_Retired;
+    MemoryIndex                                       m_NumRetiresSinceAdvance;
+
+   public:
+    EpochParticipant(EpochDomain& domain, IPolymorphicAllocator& memory) noexcept;
+
+    EpochParticipant(const EpochParticipant& rhs)            = delete;
+    EpochParticipant(EpochParticipant&& rhs)                 = delete;
+    EpochParticipant& operator=(const EpochParticipant& rhs) = delete;
+    EpochParticipant& operator=(EpochParticipant&& rhs)      = delete;
+
+    bool        IsInCriticalSection() const noexcept { return m_LocalEpoch.load(std::memory_order_relaxed) != 0u; }
+    MemoryIndex NumRetired() const noexcept { return m_Retired.size(); }
+
+    /*!
+     * @brief
+     *   Starts a critical section, shared pointers loaded after this stay valid until `Exit`.
+     *   Critical sections do not nest.
+     */
+    void Enter() noexcept;
+    void Exit() noexcept;
+
+    /*!
+     * @brief
+     *   Defers `allocator.Deallocate(ptr, size, alignment)` until no reader can be using \p ptr.
+     *   Can be called inside or outside of a critical section.
+     *
+     * @return
+     *   false if the retired list could not grow, \p ptr was not retired and is still owned by the caller.
+     */
+    bool Retire(IPolymorphicAllocator& allocator, void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
+    {
+      return RetireImpl(RetiredAllocation{ptr, size, alignment, &allocator, nullptr, 0u});
+    }
+
+    /*!
+     * @brief
+     *   Same as `Retire` but also destroys the object, for objects from `bfMemAllocateObject`.
+     */
+    template<typename T>
+    bool RetireObject(IPolymorphicAllocator& allocator, T* const ptr) noexcept
+    {
+      return RetireImpl(RetiredAllocation{ptr, sizeof(T), alignof(T), &allocator, +[](void* const ptr) { static_cast<T*>(ptr)->~T(); }, 0u});
+    }
+
+    /*!
+     * @brief
+     *   Frees every retired allocation whose grace period has passed.
+     *
+     * @return
+     *   The number of allocations freed.
+     */
+    MemoryIndex Reclaim() noexcept;
+
+    /*!
+     * @brief
+     *   Anything still waiting on a grace period is handed to the domain.
+     */
+    ~EpochParticipant() noexcept;
+
+   private:
+    bool RetireImpl(const RetiredAllocation& retired) noexcept;
+  };
+}  // namespace Memory
+
+#endif  // LIB_FOUNDATION_MEMORY_DEFERRED_FREE_HPP
+
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
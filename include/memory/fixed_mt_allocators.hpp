@@ -8,12 +8,16 @@
  * @copyright Copyright (c) 2023 Shareef Abdoul-Raheem
  */
 /******************************************************************************/
-#ifndef LIB_FOUNDATION_MEMORY_FIXED_ST_ALLOCATORS_HPP
-#define LIB_FOUNDATION_MEMORY_FIXED_ST_ALLOCATORS_HPP
+#ifndef LIB_FOUNDATION_MEMORY_FIXED_MT_ALLOCATORS_HPP
+#define LIB_FOUNDATION_MEMORY_FIXED_MT_ALLOCATORS_HPP
 
+#include "alignment.hpp"    // CacheLineSize
 #include "basic_types.hpp"  // byte, AllocationResult
 
-#include <atomic>  // std::atomic<T*>
+#include <atomic>   // std::atomic<T*>
+#include <cstddef>  // size_t
+#include <cstdint>  // uint32_t, uint64_t
+#include <utility>  // index_sequence, make_index_sequence
 
 namespace Memory
 {
@@ -25,26 +29,290 @@ namespace Memory
    * @brief
    *   This allocator is very good for temporary scoped memory allocations.
    *   There is no individual deallocation but a whole clear operation.
+   *
+   *   When constructed with a non-zero `thread_region_size` each thread reserves
+   *   a region of that size with a single atomic operation and then bump allocates
+   *   out of it without touching any shared memory, at the cost of up to a
+   *   region's worth of unused memory per thread.
+   *   Allocations larger than half a region bypass the thread regions.
    */
   class ConcurrentLinearAllocator
   {
     static_assert(std::atomic<byte*>::is_always_lock_free, "Atomic pointer expected to be lock-free.");
 
+   public:
+    static constexpr MemoryIndex DefaultThreadRegionSize = bfKilobytes(64);
+
+   private:
+    byte* const                              m_MemoryBgn;
+    byte* const                              m_MemoryEnd;
+    const MemoryIndex                        m_ThreadRegionSize;
+    const std::uint64_t                      m_Id;          //!< Identifies this allocator in each thread's region table.
+    std::atomic<std::uint64_t>               m_Generation;  //!< Bumped by `Clear` to invalidate all thread regions.
+    std::atomic<MemoryIndex>                 m_WastedBytes;
+    alignas(CacheLineSize) std::atomic<byte*> m_Current;
+
+   public:
+    ConcurrentLinearAllocator(byte* const memory_block, const MemoryIndex memory_block_size, const MemoryIndex thread_region_size = 0u) noexcept;
+
+    /*!
+     * @brief
+     *   Frees all allocations and invalidates every thread's region.
+     *   Must not be called concurrently with `Allocate`.
+     */
+    void             Clear() noexcept;
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info  */) noexcept;
+    void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+
+    /*!
+     * @brief
+     *   Number of bytes at the end of thread regions that were abandoned because
+     *   an allocation did not fit, summed over all threads since the last `Clear`.
+     *   The unused part of each thread's current region is not included.
+     */
+    MemoryIndex WastedBytes() const noexcept { return m_WastedBytes.load(std::memory_order_relaxed); }
+
+    /*!
+     * @brief
+     *   Same as `WastedBytes` but only for regions abandoned by the calling thread.
+     */
+    MemoryIndex ThreadWastedBytes() const noexcept;
+
+   private:
+    AllocationResult AllocateShared(const MemoryIndex size, const MemoryIndex alignment) noexcept;
+  };
+
+  //-------------------------------------------------------------------------------------//
+  // Concurrent Frame Allocator
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   One buffer of a `ConcurrentFrameAllocator`.
+   */
+  struct ConcurrentFrame
+  {
+    ConcurrentLinearAllocator                         allocator;
+    std::atomic<std::uint32_t>                        num_writers;            //!< Producers inside `Allocate` for this buffer, the submit waits for them to leave.
+    alignas(CacheLineSize) std::atomic<std::uint32_t> num_pending_consumers;  //!< Consumers that have not called `ReleaseFrame` for `index`.
+    std::atomic<std::uint64_t>                        index;                  //!< The frame number this buffer was last used for.
+
+    ConcurrentFrame(byte* const memory_block, const MemoryIndex memory_block_size, const MemoryIndex thread_region_size) noexcept :
+      allocator{memory_block, memory_block_size, thread_region_size},
+      num_writers{0u},
+      num_pending_consumers{0u},
+      index{0u}
+    {
+    }
+  };
+
+  /*!
+   * @brief
+   *   The non templated part of `ConcurrentFrameAllocator`.
+   */
+  class ConcurrentFrameAllocatorBase
+  {
+   private:
+    ConcurrentFrame* const                            m_Frames;
+    const MemoryIndex                                 m_NumFrames;
+    alignas(CacheLineSize) std::atomic<std::uint64_t> m_CurrentFrame;
+
+   protected:
+    ConcurrentFrameAllocatorBase(ConcurrentFrame* const frames, const MemoryIndex num_frames) noexcept;
+
+   public:
+    ConcurrentFrameAllocatorBase(const ConcurrentFrameAllocatorBase& rhs)            = delete;
+    ConcurrentFrameAllocatorBase(ConcurrentFrameAllocatorBase&& rhs)                 = delete;
+    ConcurrentFrameAllocatorBase& operator=(const ConcurrentFrameAllocatorBase& rhs) = delete;
+    ConcurrentFrameAllocatorBase& operator=(ConcurrentFrameAllocatorBase&& rhs)      = delete;
+
+    /*!
+     * @brief
+     *   The number of the frame `Allocate` is currently serving.
+     */
+    std::uint64_t CurrentFrame() const noexcept { return m_CurrentFrame.load(std::memory_order_acquire); }
+
+    /*!
+     * @brief
+     *   Ends the current frame and starts the next one, waiting for the consumers of the
+     *   frame `NumFrames` back from the next one if they have not all released it yet.
+     *
+     *   Must only be called from one thread at a time but may race with `Allocate`,
+     *   an allocation racing with the submit lands in either the old or new frame
+     *   and one landing in the old frame has finished before this returns. Writes into
+     *   the allocated memory are not covered, producers must be done filling in the
+     *   frame before it is submitted.
+     *
+     * @param num_consumers
+     *   The number of `ReleaseFrame` calls needed before the submitted frame's memory can be reused,
+     *   0 means it can be reused as soon as the allocator wraps back around to it.
+     *
+     * @return
+     *   The number of the submitted frame to pass to consumers.
+     */
+    std::uint64_t SubmitFrame(const std::uint32_t num_consumers) noexcept;
+
+    /*!
+     * @brief
+     *   Same as `SubmitFrame` but returns false rather than waiting if
+     *   the next frame is still in use, nothing is changed on failure.
+     */
+    bool TrySubmitFrame(const std::uint32_t num_consumers, std::uint64_t* const out_frame) noexcept;
+
+    /*!
+     * @brief
+     *   Signals that one consumer is done reading \p frame, safe to call from any thread.
+     */
+    void ReleaseFrame(const std::uint64_t frame) noexcept;
+
+    /*!
+     * @brief
+     *   Whether every consumer of \p frame has released it.
+     */
+    bool IsFrameReleased(const std::uint64_t frame) const noexcept;
+
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept;
+    void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+
+   private:
+    ConcurrentFrame& FrameOf(const std::uint64_t frame) const noexcept { return m_Frames[frame % m_NumFrames]; }
+    bool             IsFrameFree(const ConcurrentFrame& frame) const noexcept { return frame.num_pending_consumers.load(std::memory_order_acquire) == 0u; }
+    std::uint64_t    AdvanceFrame(const std::uint32_t num_consumers) noexcept;
+  };
+
+  /*!
+   * @brief
+   *   N-buffered linear allocator for pipelines where frame K is being produced
+   *   while earlier frames are still being read by consumers on other threads.
+   *
+   *   Each frame gets its own `ConcurrentLinearAllocator` over an equal slice of the memory
+   *   block so multiple producer threads can bump allocate the current frame concurrently.
+   *   A frame's memory is only cleared once the producer wraps back around to it and
+   *   every consumer it was submitted with has called `ReleaseFrame`, so there is no
+   *   individual deallocation and no use after reset.
+   *
+   *   ```
+   *   ConcurrentFrameAllocator<3> frames{memory, memory_size};
+   *
+   *   // Producer
+   *   Job* const job = bfMemAllocateObject<Job>(frames, ...);
+   *   const std::uint64_t frame = frames.SubmitFrame(num_workers);
+   *
+   *   // Each consumer once done reading `frame`.
+   *   frames.ReleaseFrame(frame);
+   *   ```
+   *
+   * @tparam NumFrames
+   *   The number of frames that can be in flight at once, 2 for double buffering.
+   */
+  template<MemoryIndex NumFrames>
+  class ConcurrentFrameAllocator : public ConcurrentFrameAllocatorBase
+  {
+    static_assert(NumFrames >= 2u, "There must be at least one frame to produce and one to consume.");
+
+   private:
+    ConcurrentFrame m_FrameStorage[NumFrames];
+
+   public:
+    ConcurrentFrameAllocator(byte* const memory_block, const MemoryIndex memory_block_size, const MemoryIndex thread_region_size = 0u) noexcept :
+      ConcurrentFrameAllocator(memory_block, memory_block_size / NumFrames, thread_region_size, std::make_index_sequence<NumFrames>{})
+    {
+    }
+
+   private:
+    template<std::size_t... FrameIndex>
+    ConcurrentFrameAllocator(byte* const memory_block, const MemoryIndex frame_size, const MemoryIndex thread_region_size, std::index_sequence<FrameIndex...>) noexcept :
+      ConcurrentFrameAllocatorBase(m_FrameStorage, NumFrames),
+      m_FrameStorage{{memory_block + FrameIndex * frame_size, frame_size, thread_region_size}...}
+    {
+    }
+  };
+
+  //-------------------------------------------------------------------------------------//
+  // Concurrent Pool Allocator
+  //-------------------------------------------------------------------------------------//
+
+  struct PoolAllocatorBlock;
+
+  /*!
+   * @brief
+   *   Lock-free (Treiber) stack of `PoolAllocatorBlock`s.
+   *
+   *   The head pointer is packed with a modification counter into a single
+   *   64bit word so that a pop racing with a pop + push of the same block (ABA)
+   *   fails the compare exchange rather than corrupting the list.
+   *
+   *   Blocks popped off the stack must stay readable (not returned to the OS)
+   *   for as long as the stack is in use since a racing pop may read `next` of
+   *   a block that was just taken by another thread.
+   */
+  class alignas(CacheLineSize) ConcurrentPoolFreelist
+  {
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Atomic 64bit integer expected to be lock-free.");
+
+   private:
+    std::atomic<std::uint64_t> m_Head;
+
+   public:
+    ConcurrentPoolFreelist() noexcept :
+      m_Head{0u}
+    {
+    }
+
+    ConcurrentPoolFreelist(const ConcurrentPoolFreelist& rhs)            = delete;
+    ConcurrentPoolFreelist(ConcurrentPoolFreelist&& rhs)                 = delete;
+    ConcurrentPoolFreelist& operator=(const ConcurrentPoolFreelist& rhs) = delete;
+    ConcurrentPoolFreelist& operator=(ConcurrentPoolFreelist&& rhs)      = delete;
+
+    /*!
+     * @brief
+     *   Replaces the contents of the stack, not thread-safe.
+     */
+    void Reset(PoolAllocatorBlock* const head) noexcept;
+
+    /*!
+     * @brief
+     *   Pushes an already linked list of blocks (`tail` reachable from `head`) in a single operation.
+     */
+    void                PushList(PoolAllocatorBlock* const head, PoolAllocatorBlock* const tail) noexcept;
+    void                Push(PoolAllocatorBlock* const block) noexcept { PushList(block, block); }
+    PoolAllocatorBlock* Pop() noexcept;
+  };
+
+  /*!
+   * @brief
+   *   Thread-safe version of `PoolAllocator`, allocation and deallocation
+   *   are each a single compare exchange in the uncontended case.
+   *
+   *   Blocks never allocated since the last `Reset` are handed out with a
+   *   fetch_add on a bump index once the freelist is empty, so `Reset` is O(1).
+   */
+  class ConcurrentPoolAllocator
+  {
    private:
-    byte* const        m_MemoryBgn;
-    byte* const        m_MemoryEnd;
-    std::atomic<byte*> m_Current;
+    byte* const                                     m_MemoryBgn;  //!< Aligned start of the first block.
+    byte* const                                     m_MemoryEnd;
+    MemoryIndex                                     m_BlockSize;
+    MemoryIndex                                     m_Alignment;
+    MemoryIndex                                     m_NumElements;
+    ConcurrentPoolFreelist                          m_Freelist;
+    alignas(CacheLineSize) std::atomic<MemoryIndex> m_NumBumped;  //!< Index of the next never allocated block, can overshoot `m_NumElements`.
 
    public:
-    ConcurrentLinearAllocator(byte* const memory_block, const MemoryIndex memory_block_size) noexcept;
+    ConcurrentPoolAllocator(byte* const memory_block, const MemoryIndex memory_size, const MemoryIndex block_size, const MemoryIndex alignment) noexcept;
 
-    void             Clear() noexcept { m_Current.store(m_MemoryBgn); }
+    /*!
+     * @brief
+     *   Returns all blocks to the pool, not thread-safe.
+     */
+    void             Reset() noexcept;
     AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info  */) noexcept;
     void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+    void             DeallocateBatch(void* const* const ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment) noexcept;  //!< A single CAS for the whole batch.
   };
 }  // namespace Memory
 
-#endif  // LIB_FOUNDATION_MEMORY_FIXED_ST_ALLOCATORS_HPP
+#endif  // LIB_FOUNDATION_MEMORY_FIXED_MT_ALLOCATORS_HPP
 
 /******************************************************************************/
 /*
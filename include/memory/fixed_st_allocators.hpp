@@ -24,6 +24,8 @@ namespace Memory
    * @brief
    *   This allocator is very good for temporary scoped memory allocations.
    *   There is no individual deallocation but a whole clear operation.
+   *
+   *   The most recent allocation can be resized in place in O(1).
    */
   class LinearAllocator
   {
@@ -49,6 +51,8 @@ namespace Memory
     bool             CanServiceAllocation(const MemoryIndex size, const MemoryIndex alignment) const noexcept;
     AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info */) noexcept;
     void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+    AllocationResult Resize(void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info */) noexcept;
+    void             QueryStats(AllocatorStats& out_stats) const noexcept;
   };
 
   inline LinearAllocator LinearAllocatorFromMemoryRequirements(void* const buffer, const MemoryRequirements mem_reqs)
@@ -110,10 +114,15 @@ namespace Memory
    *   This allocator is a designed for allocations where you can guarantee
    *   deallocation is in a LIFO (Last in First Out) order in return you get
    *   some speed.
+   *
+   *   Only the top of the stack can grow in place, any block can shrink in place.
+   *
+   *   The stack cannot be walked so `QueryStats` counts the allocation headers as used memory.
    */
   class StackAllocator
   {
    private:
+    const byte* m_MemoryBgn;
     byte*       m_StackPtr;
     const byte* m_MemoryEnd;
 
@@ -122,6 +131,8 @@ namespace Memory
 
     AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info  */) noexcept;
     void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+    AllocationResult Resize(void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info */) noexcept;
+    void             QueryStats(AllocatorStats& out_stats) const noexcept;
   };
 
   //-------------------------------------------------------------------------------------//
@@ -147,15 +158,24 @@ namespace Memory
    *
    *  The PoolAllocatorBlock does not actually take up any memory since
    *  it is only used when it is in the pool freelist.
+   *
+   *  The freelist is built lazily, blocks that have never been handed out are
+   *  bumped off the end of the used region so construction and `Reset` are O(1)
+   *  and each page is only touched once a block in it is first used.
+   *
+   *  The batch operations pop / push a whole segment of the freelist at once.
+   *
+   *  `QueryStats` walks the freelist so is O(number of free blocks).
    */
   class PoolAllocator
   {
    private:
-    byte* const         m_MemoryBgn;
+    byte* const         m_MemoryBgn;  //!< Aligned start of the first block.
     byte* const         m_MemoryEnd;
     MemoryIndex         m_BlockSize;
     MemoryIndex         m_Alignment;
     PoolAllocatorBlock* m_PoolHead;
+    byte*               m_BumpCurrent;  //!< Blocks from here to `m_MemoryEnd` have never been allocated since the last `Reset`.
     MemoryIndex         m_NumElements;
 
    public:
@@ -166,8 +186,17 @@ namespace Memory
     void*            FromIndex(const MemoryIndex index) noexcept;  // The index must have been from 'IndexOf'
     AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info  */) noexcept;
     void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+    MemoryIndex      AllocateBatch(void** const out_ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info  */) noexcept;
+    void             DeallocateBatch(void* const* const ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+    void             QueryStats(AllocatorStats& out_stats) const noexcept;
 
     static PoolAllocatorSetupResult SetupPool(byte* const memory_block, const MemoryIndex memory_size, const MemoryIndex block_size, const MemoryIndex alignment) noexcept;
+    static PoolAllocatorSetupResult LinkBlocks(void* const* const ptrs, const MemoryIndex num_ptrs) noexcept;                                // Chains `ptrs` into a list in array order.
+    static MemoryIndex              PopBlocks(PoolAllocatorBlock** const head, void** const out_ptrs, const MemoryIndex num_ptrs) noexcept;   // Returns the number of blocks popped.
+    static void                     PushBlocks(PoolAllocatorBlock** const head, void* const* const ptrs, const MemoryIndex num_ptrs) noexcept;  // Pushes `ptrs` onto the front of the list.
+
+   private:
+    bool HasUntouchedBlock() const noexcept { return m_BumpCurrent < m_MemoryEnd && MemoryIndex(m_MemoryEnd - m_BumpCurrent) >= m_BlockSize; }
   };
 
   /*!
@@ -178,19 +207,19 @@ namespace Memory
   {
     static constexpr std::size_t header_alignment  = alignof(PoolAllocatorBlock);
     static constexpr std::size_t actual_alignment  = alignment < header_alignment ? header_alignment : alignment;
-    static constexpr std::size_t actual_block_size = Memory::AlignSize<actual_alignment>(kblock_size);
+    static constexpr std::size_t actual_block_size = Memory::AlignSize(kblock_size, actual_alignment);
     static constexpr std::size_t memory_block_size = actual_block_size * num_blocks;
 
    private:
     /*!
      * @brief
-     *   `buffer` is not initialized by design since the `PoolAllocator` ctor writes to it.
+     *   `buffer` is not initialized by design since the `PoolAllocator` only writes to a block once it is used.
      */
     alignas(actual_alignment) byte m_Buffer[memory_block_size];
 
    public:
     FixedPoolAllocator() :
-      PoolAllocator(m_Buffer, sizeof(m_Buffer), actual_block_size)
+      PoolAllocator(m_Buffer, sizeof(m_Buffer), actual_block_size, actual_alignment)
     {
     }
   };
@@ -212,23 +241,65 @@ namespace Memory
    *
    *   - Allocation   : A first fit policy is used.
    *   - Deallocation : Added to freelist in address order, block merging is attempted.
+   *   - Resize       : Grows into the free block directly after it, shrinking gives the tail back to the freelist.
+   *   - QueryStats   : Walks every block, free or used, in address order.
    */
   class FreeListAllocator
   {
    private:
     FreeListNode* m_Freelist;
+    byte*         m_MemoryBgn;  //!< The first block.
+    byte*         m_MemoryEnd;  //!< End of the last block.
 
    public:
     FreeListAllocator(byte* const memory_block, MemoryIndex memory_block_size);
 
     AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info  */) noexcept;
     void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+    AllocationResult Resize(void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info */) noexcept;
+    void             QueryStats(AllocatorStats& out_stats) const noexcept;
 
    private:
     AllocationResult AllocateInternal(const MemoryIndex size) noexcept;
     void             DeallocateInternal(void* const ptr, const MemoryIndex size) noexcept;
   };
 
+  //-------------------------------------------------------------------------------------//
+  // TLSF Allocator
+  //-------------------------------------------------------------------------------------//
+
+  struct TLSFControl;
+
+  /*!
+   * @brief
+   *   Two-Level Segregated Fit allocator, a general purpose allocator with
+   *   O(1) allocation and deallocation.
+   *
+   *   Free blocks are binned by size into a two-level bitmap indexed table so
+   *   finding a fitting block is a couple of bit scans rather than a list walk,
+   *   every block records its physical neighbor so coalescing is also O(1).
+   *
+   *   Same inputs as `FreeListAllocator` so can be used as a drop in replacement
+   *   when allocation latency matters, the bookkeeping table (~8KiB) is stored
+   *   at the start of the memory block.
+   *
+   *   - Allocation   : A good fit policy is used, fragmentation bounded by the second level subdivisions.
+   *   - Deallocation : Immediately merged with free physical neighbors.
+   *   - QueryStats   : Walks every block, free or used, in address order.
+   */
+  class TLSFAllocator
+  {
+   private:
+    TLSFControl* m_Control;
+
+   public:
+    TLSFAllocator(byte* const memory_block, const MemoryIndex memory_block_size) noexcept;
+
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info  */) noexcept;
+    void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+    void             QueryStats(AllocatorStats& out_stats) const noexcept;
+  };
+
 }  // namespace Memory
 
 #endif  // LIB_FOUNDATION_MEMORY_FIXED_ST_ALLOCATORS_HPP
@@ -0,0 +1,209 @@
+/******************************************************************************/
+/*!
+ * @file   growing_mt_allocators.hpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Contains growing thread-safe allocators.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#ifndef LIB_FOUNDATION_MEMORY_GROWING_MT_ALLOCATORS_HPP
+#define LIB_FOUNDATION_MEMORY_GROWING_MT_ALLOCATORS_HPP
+
+#include "alignment.hpp"            // DefaultAlignment, CacheLineSize
+#include "basic_types.hpp"          // IPolymorphicAllocator, MemoryIndex
+#include "fixed_mt_allocators.hpp"  // ConcurrentPoolFreelist
+
+#include <atomic>  // atomic
+#include <mutex>   // mutex
+
+namespace Memory
+{
+  //-------------------------------------------------------------------------------------//
+  // Concurrent Growing Pool Allocator: Like ConcurrentPoolAllocator except that it grows in chunks.
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   Thread-safe version of `GrowingPoolAllocator`.
+   *
+   *   When the pool runs dry the calling thread requests a new chunk from the parent,
+   *   keeps one block for itself and pushes the rest onto the shared freelist in a
+   *   single operation without taking any locks.
+   *   Threads that run dry at the same time may each add a chunk.
+   *
+   *   The parent allocator must be thread-safe, chunks are only returned to it on `FreeMemory`.
+   */
+  class ConcurrentGrowingPoolAllocator
+  {
+   private:
+    struct ChunkFooter
+    {
+      // byte[m_ChunkMemSize];
+      ChunkFooter* next;
+    };
+
+   private:
+    IPolymorphicAllocator&    m_ParentAllocator;
+    MemoryIndex               m_BlockSize;
+    MemoryIndex               m_Alignment;
+    MemoryIndex               m_ChunkMemSize;
+    std::atomic<ChunkFooter*> m_Chunks;
+    ConcurrentPoolFreelist    m_Freelist;
+
+   public:
+    ConcurrentGrowingPoolAllocator(
+     IPolymorphicAllocator& parent_allocator,
+     const MemoryIndex      block_size,
+     const MemoryIndex      block_alignment,
+     const MemoryIndex      num_blocks_per_chunk) noexcept;
+
+    ConcurrentGrowingPoolAllocator(const ConcurrentGrowingPoolAllocator& rhs)            = delete;
+    ConcurrentGrowingPoolAllocator(ConcurrentGrowingPoolAllocator&& rhs)                 = delete;
+    ConcurrentGrowingPoolAllocator& operator=(const ConcurrentGrowingPoolAllocator& rhs) = delete;
+    ConcurrentGrowingPoolAllocator& operator=(ConcurrentGrowingPoolAllocator&& rhs)      = delete;
+
+    /*!
+     * @brief
+     *   Returns all blocks to the pool while keeping the chunks, not thread-safe.
+     */
+    void             Clear() noexcept;
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept;
+    void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+    void             DeallocateBatch(void* const* const ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment) noexcept;  //!< A single CAS for the whole batch.
+
+    /*!
+     * @brief
+     *   Returns all chunks to the parent allocator, not thread-safe.
+     */
+    void FreeMemory() noexcept;
+
+    ~ConcurrentGrowingPoolAllocator() noexcept { FreeMemory(); }
+  };
+
+  template<MemoryIndex BlockSize, MemoryIndex BlockAlignment, MemoryIndex NumBlocksPerChunk>
+  class StaticConcurrentGrowingPoolAllocator : public ConcurrentGrowingPoolAllocator
+  {
+    static_assert(NumBlocksPerChunk > 0u, "Number of items in each chunk must be greater than 0.");
+    static_assert(BlockSize >= sizeof(void*), "BlockSize must be >= sizeof(PoolAllocatorBlock).");
+    static_assert(BlockAlignment > 0u, "BlockAlignment must be greater than 0.");
+
+   public:
+    StaticConcurrentGrowingPoolAllocator(IPolymorphicAllocator& parent_allocator) :
+      ConcurrentGrowingPoolAllocator(parent_allocator, BlockSize, BlockAlignment, NumBlocksPerChunk)
+    {
+    }
+  };
+
+  template<typename T, MemoryIndex NumBlocksPerChunk>
+  using ConcurrentObjectPool = StaticConcurrentGrowingPoolAllocator<sizeof(T), alignof(T), NumBlocksPerChunk>;
+
+  //-------------------------------------------------------------------------------------//
+  // Thread Cache Allocator: Per-thread size-class freelists in front of a parent allocator.
+  //-------------------------------------------------------------------------------------//
+
+  struct PoolAllocatorBlock;
+  struct ThreadCacheBatch;
+  struct ThreadCacheSpan;
+  struct ThreadCacheTableCleanup;
+
+  /*!
+   * @brief
+   *   Small allocations are served from a per-thread freelist (magazine) for each size class,
+   *   the hot path of `Allocate` and `Deallocate` does not touch any memory shared between threads.
+   *
+   *   Magazines are refilled from and overflow into a shared depot in batches of blocks,
+   *   the depot grows in spans requested from the parent allocator.
+   *
+   *   Allocations larger than `MaxCachedSize` or aligned to more than `CachedAlignment`
+   *   are forwarded to the parent allocator directly.
+   *
+   *   The parent allocator must be thread-safe, spans are only returned to it on destruction.
+   *   The allocator must outlive any use of it by any thread.
+   */
+  class ThreadCacheAllocator
+  {
+   public:
+    static constexpr MemoryIndex NumSizeClasses  = 20u;
+    static constexpr MemoryIndex MaxCachedSize   = 1024u;
+    static constexpr MemoryIndex CachedAlignment = DefaultAlignment;
+    static constexpr MemoryIndex DefaultSpanSize = bfKilobytes(64);
+
+    struct ThreadCache;
+
+   private:
+    struct alignas(CacheLineSize) SizeClassDepot
+    {
+      std::mutex          lock;
+      ThreadCacheBatch*   full_batches;   //!< Batches of exactly `BatchCount` blocks.
+      PoolAllocatorBlock* partial_head;   //!< Loose blocks flushed from exiting threads.
+      MemoryIndex         partial_count;  //!< Number of blocks in `partial_head`.
+      ThreadCacheSpan*    spans;          //!< All memory owned by this size class.
+    };
+
+   private:
+    IPolymorphicAllocator& m_ParentAllocator;
+    MemoryIndex            m_SpanSize;
+    ThreadCache*           m_RegisteredCaches;  //!< Guarded by a global lock, only touched on thread cache creation or destruction.
+    SizeClassDepot         m_Depots[NumSizeClasses];
+
+   public:
+    ThreadCacheAllocator(IPolymorphicAllocator& parent_allocator, const MemoryIndex span_size = DefaultSpanSize) noexcept;
+
+    ThreadCacheAllocator(const ThreadCacheAllocator& rhs)            = delete;
+    ThreadCacheAllocator(ThreadCacheAllocator&& rhs)                 = delete;
+    ThreadCacheAllocator& operator=(const ThreadCacheAllocator& rhs) = delete;
+    ThreadCacheAllocator& operator=(ThreadCacheAllocator&& rhs)      = delete;
+
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept;
+    void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+
+    /*!
+     * @brief
+     *   Returns all blocks cached by the calling thread back to the shared depot.
+     *   This happens automatically on thread exit.
+     */
+    void FlushThreadCache() noexcept;
+
+    ~ThreadCacheAllocator() noexcept;
+
+   private:
+    ThreadCache*        FindThreadCache() noexcept;
+    ThreadCache*        RegisterThreadCache() noexcept;
+    PoolAllocatorBlock* RefillFromDepot(const MemoryIndex size_class, MemoryIndex* const out_count) noexcept;
+    void                ReturnBatchToDepot(const MemoryIndex size_class, ThreadCacheBatch* const batch) noexcept;
+    void                ReturnBlocksToDepot(const MemoryIndex size_class, PoolAllocatorBlock* const head, PoolAllocatorBlock* const tail, const MemoryIndex count) noexcept;
+    void                FlushThreadCache(ThreadCache& cache) noexcept;
+
+    friend struct ThreadCacheTableCleanup;
+  };
+}  // namespace Memory
+
+#endif  // LIB_FOUNDATION_MEMORY_GROWING_MT_ALLOCATORS_HPP
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
@@ -11,8 +11,12 @@
 #ifndef LIB_FOUNDATION_MEMORY_GROWING_ST_ALLOCATORS_HPP
 #define LIB_FOUNDATION_MEMORY_GROWING_ST_ALLOCATORS_HPP
 
+#include "alignment.hpp"    // DefaultAlignment
 #include "basic_types.hpp"  // IPolymorphicAllocator, MemoryIndex
 
+#include <cstddef>  // size_t
+#include <utility>  // index_sequence, make_index_sequence
+
 namespace Memory
 {
   //-------------------------------------------------------------------------------------//
@@ -21,36 +25,139 @@ namespace Memory
 
   struct PoolAllocatorBlock;
 
+  /*!
+   * @brief
+   *   Like `PoolAllocator` the freelist is built lazily, a chunk's blocks are bumped
+   *   out in order the first time they are needed so `Clear` and adding a new chunk
+   *   are O(1) rather than writing to every block.
+   *
+   *   Chunks are kept in an array sorted by address so a block can be mapped back
+   *   to its chunk with a binary search, this gives `IndexOf` / `FromIndex` like
+   *   `PoolAllocator`. Each chunk also gets an id that does not change while the
+   *   chunk is alive so an index stays valid as other chunks come and go and
+   *   can be stored as a 32-bit handle in place of a pointer.
+   *
+   *   With `track_chunks` each chunk gets its own freelist and live block count:
+   *     - Allocation prefers partially full chunks over completely free ones so
+   *       memory compacts into as few chunks as possible.
+   *     - Completely free chunks can be returned to the parent with `Trim`, or
+   *       automatically once there are more than `free_chunk_slack` of them.
+   *   This costs a chunk lookup on each deallocation so it is off by default.
+   *
+   *   The chunk index comes from `index_allocator`, the parent when not given.
+   *   With a page granular parent (`HugePageAllocator`, `NumaNodeAllocator`) pass
+   *   a general heap so the parent is not asked for a whole page each time the index grows.
+   */
   class GrowingPoolAllocator
   {
+   public:
+    static constexpr MemoryIndex NoAutoTrim = MemoryIndex(-1);  //!< Free chunks are only returned by `Trim`.
+
    private:
     struct ChunkFooter
     {
       // byte[m_ChunkMemSize];
-      ChunkFooter* next;
+      ChunkFooter*        prev;       //!< Link in either `m_PartialChunks` or `m_FreeChunks` (chunk tracking only).
+      ChunkFooter*        next;       //!< Link in either `m_PartialChunks` or `m_FreeChunks` (chunk tracking only).
+      PoolAllocatorBlock* free_list;  //!< Blocks freed back to this chunk (chunk tracking only).
+      MemoryIndex         num_live;   //!< Number of allocated blocks (chunk tracking only).
+      MemoryIndex         num_bumped; //!< Number of blocks handed out at least once since the last `Clear` (chunk tracking only).
+      MemoryIndex         id;         //!< Slot in `m_ChunkById`.
     };
 
    private:
     IPolymorphicAllocator& m_ParentAllocator;
+    IPolymorphicAllocator& m_IndexAllocator;      //!< Where `m_ChunkIndex` / `m_ChunkById` are allocated from.
     MemoryIndex            m_BlockSize;
     MemoryIndex            m_Alignment;
     MemoryIndex            m_ChunkMemSize;
-    ChunkFooter*           m_Chunks;
+    MemoryIndex            m_NumBlocksPerChunk;
+    ChunkFooter**          m_ChunkIndex;          //!< Every chunk sorted by address.
+    ChunkFooter**          m_ChunkById;           //!< Chunks by `ChunkFooter::id`, released ids are nullptr, shares an allocation with `m_ChunkIndex`.
+    MemoryIndex            m_NumChunks;
+    MemoryIndex            m_NumChunkIds;         //!< One past the highest id in use.
+    MemoryIndex            m_ChunkIndexCapacity;
     PoolAllocatorBlock*    m_PoolHead;
+    byte*                  m_BumpCurrent;         //!< Next never allocated block in the current bump chunk.
+    byte*                  m_BumpEnd;             //!< End of the current bump chunk.
+    MemoryIndex            m_NextUntouchedChunk;  //!< Index of the next chunk in `m_ChunkIndex` not used since the last `Clear`.
+    ChunkFooter*           m_PartialChunks;       //!< Chunks with some but not all blocks allocated (chunk tracking only).
+    ChunkFooter*           m_FreeChunks;          //!< Chunks with no blocks allocated (chunk tracking only).
+    MemoryIndex            m_NumFreeChunks;
+    MemoryIndex            m_FreeChunkSlack;
+    bool                   m_TrackChunks;
 
    public:
     GrowingPoolAllocator(
      IPolymorphicAllocator& parent_allocator,
      const MemoryIndex      block_size,
      const MemoryIndex      block_alignment,
-     const MemoryIndex      num_blocks_per_chunk) noexcept;
+     const MemoryIndex      num_blocks_per_chunk,
+     const bool             track_chunks     = false,
+     const MemoryIndex      free_chunk_slack = NoAutoTrim) noexcept :
+      GrowingPoolAllocator(parent_allocator, block_size, block_alignment, num_blocks_per_chunk, track_chunks, free_chunk_slack, parent_allocator)
+    {
+    }
+
+    GrowingPoolAllocator(
+     IPolymorphicAllocator& parent_allocator,
+     const MemoryIndex      block_size,
+     const MemoryIndex      block_alignment,
+     const MemoryIndex      num_blocks_per_chunk,
+     const bool             track_chunks,
+     const MemoryIndex      free_chunk_slack,
+     IPolymorphicAllocator& index_allocator) noexcept;
+
+    GrowingPoolAllocator(const GrowingPoolAllocator& rhs)            = delete;
+    GrowingPoolAllocator(GrowingPoolAllocator&& rhs)                 = delete;
+    GrowingPoolAllocator& operator=(const GrowingPoolAllocator& rhs) = delete;
+    GrowingPoolAllocator& operator=(GrowingPoolAllocator&& rhs)      = delete;
+
+    /*!
+     * @brief
+     *   The most blocks that fit in a chunk where the parent allocation, footer included, is at most \p chunk_size.
+     *   Used with page based parents such as `HugePageAllocator` so each chunk exactly fills its pages.
+     *
+     * @return
+     *   At least 1 even if a single block does not fit.
+     */
+    static MemoryIndex NumBlocksPerChunkForSize(const MemoryIndex block_size, const MemoryIndex block_alignment, const MemoryIndex chunk_size) noexcept;
+
+    MemoryIndex NumChunks() const { return m_NumChunks; }
+    MemoryIndex NumFreeChunks() const { return m_NumFreeChunks; }
+    bool        IsPtrInRange(const void* const ptr) const noexcept { return FindChunk(ptr) != nullptr; }
 
     void             Clear() noexcept;
     AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept;
     void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept;
-    void             FreeMemory() noexcept;
+    MemoryIndex      AllocateBatch(void** const out_ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept;
+    void             DeallocateBatch(void* const* const ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+    MemoryIndex      IndexOf(const void* ptr) const noexcept;
+    void*            FromIndex(const MemoryIndex index) const noexcept;  // The index must have been from 'IndexOf' and its chunk not released since.
+    void             QueryStats(AllocatorStats& out_stats) const noexcept;   // O(number of chunks) with chunk tracking, otherwise O(number of free blocks).
+
+    /*!
+     * @brief
+     *   Returns every completely free chunk to the parent allocator, only does anything with chunk tracking.
+     *
+     * @return
+     *   The number of chunks released.
+     */
+    MemoryIndex Trim() noexcept;
+
+    void FreeMemory() noexcept;
 
     ~GrowingPoolAllocator() noexcept { FreeMemory(); }
+
+   private:
+    byte*               ChunkBgn(ChunkFooter* const chunk) const noexcept { return reinterpret_cast<byte*>(chunk) - m_ChunkMemSize; }
+    ChunkFooter*        FindChunk(const void* const ptr) const noexcept;
+    PoolAllocatorBlock* BumpBlock() noexcept;
+    PoolAllocatorBlock* AllocateTracked(const AllocationSourceInfo& source_info) noexcept;
+    void                DeallocateTracked(void* const ptr) noexcept;
+    bool                GrowChunk(const AllocationSourceInfo& source_info) noexcept;
+    void                ReleaseChunk(ChunkFooter* const chunk) noexcept;
+    void                TrimToSlack() noexcept;
   };
 
   template<MemoryIndex BlockSize, MemoryIndex BlockAlignment, MemoryIndex NumBlocksPerChunk>
@@ -61,8 +168,13 @@ namespace Memory
     static_assert(BlockAlignment > 0u, "BlockAlignment must be greater than alignof(void*).");
 
    public:
-    StaticGrowingPoolAllocator(IPolymorphicAllocator& parent_allocator) :
-      GrowingPoolAllocator(parent_allocator, BlockSize, BlockAlignment, NumBlocksPerChunk)
+    StaticGrowingPoolAllocator(IPolymorphicAllocator& parent_allocator, const bool track_chunks = false, const MemoryIndex free_chunk_slack = NoAutoTrim) :
+      GrowingPoolAllocator(parent_allocator, BlockSize, BlockAlignment, NumBlocksPerChunk, track_chunks, free_chunk_slack)
+    {
+    }
+
+    StaticGrowingPoolAllocator(IPolymorphicAllocator& parent_allocator, const bool track_chunks, const MemoryIndex free_chunk_slack, IPolymorphicAllocator& index_allocator) :
+      GrowingPoolAllocator(parent_allocator, BlockSize, BlockAlignment, NumBlocksPerChunk, track_chunks, free_chunk_slack, index_allocator)
     {
     }
   };
@@ -70,6 +182,328 @@ namespace Memory
   template<typename T, MemoryIndex NumBlocksPerChunk>
   using ObjectPool = StaticGrowingPoolAllocator<sizeof(T), alignof(T), NumBlocksPerChunk>;
 
+  //-------------------------------------------------------------------------------------//
+  // Size Class Pool Allocator: A GrowingPoolAllocator for each of a compile time list of sizes.
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   Small object allocator with a `GrowingPoolAllocator` bucket for each size class,
+   *   anything larger than the last size class (or more aligned than its bucket) goes to a fallback allocator.
+   *
+   *   The bucket for a size comes from a constexpr table indexed by `size / SizeClassGranularity`
+   *   so `Allocate` is a table load, and when the size is a constant (`bfMemAllocateObject<T>`)
+   *   the optimizer folds it away. `Allocate<Size, Alignment>` guarantees it is resolved at compile time.
+   *
+   *   Each bucket is aligned to the largest power of two dividing its size class, up to `DefaultAlignment`.
+   *
+   *   ```
+   *   SizeClassPoolAllocator<16, 32, 48, 64, 128, 256> small_objects{parent, fallback};
+   *   ```
+   *
+   * @tparam SizeClasses
+   *   Strictly increasing multiples of `SizeClassGranularity`.
+   */
+  template<MemoryIndex... SizeClasses>
+  class SizeClassPoolAllocator
+  {
+   public:
+    static constexpr MemoryIndex NumSizeClasses       = sizeof...(SizeClasses);
+    static constexpr MemoryIndex SizeClassGranularity = 8u;
+    static constexpr MemoryIndex DefaultChunkSize     = bfKilobytes(16);  //!< Approximate size of each chunk requested from the parent.
+    static constexpr MemoryIndex FallbackBucket       = NumSizeClasses;   //!< `BucketIndex` of requests that do not fit in any bucket.
+
+   private:
+    static constexpr MemoryIndex s_SizeClasses[] = {SizeClasses...};
+
+   public:
+    static constexpr MemoryIndex MaxPooledSize = s_SizeClasses[NumSizeClasses - 1u];
+
+   private:
+    struct LookupTable
+    {
+      unsigned char bucket[MaxPooledSize / SizeClassGranularity + 1u];
+    };
+
+    static constexpr bool AreSizeClassesValid() noexcept
+    {
+      for (MemoryIndex index = 0u; index < NumSizeClasses; ++index)
+      {
+        if (s_SizeClasses[index] == 0u || s_SizeClasses[index] % SizeClassGranularity != 0u || (index != 0u && s_SizeClasses[index - 1u] >= s_SizeClasses[index]))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    static constexpr LookupTable MakeLookupTable() noexcept
+    {
+      LookupTable table  = {};
+      MemoryIndex bucket = 0u;
+
+      for (MemoryIndex index = 0u; index < sizeof(table.bucket); ++index)
+      {
+        while (s_SizeClasses[bucket] < index * SizeClassGranularity)
+        {
+          ++bucket;
+        }
+
+        table.bucket[index] = static_cast<unsigned char>(bucket);
+      }
+
+      return table;
+    }
+
+    static_assert(NumSizeClasses > 0u && NumSizeClasses < 256u, "There must be between 1 and 255 size classes.");
+    static_assert(AreSizeClassesValid(), "Size classes must be strictly increasing non-zero multiples of SizeClassGranularity.");
+
+    static constexpr LookupTable s_Lookup = MakeLookupTable();
+
+   private:
+    GrowingPoolAllocator   m_Buckets[NumSizeClasses];
+    IPolymorphicAllocator& m_FallbackAllocator;
+
+   public:
+    static constexpr MemoryIndex BucketSize(const MemoryIndex bucket) noexcept { return s_SizeClasses[bucket]; }
+
+    static constexpr MemoryIndex BucketAlignment(const MemoryIndex bucket) noexcept
+    {
+      const MemoryIndex size         = s_SizeClasses[bucket];
+      const MemoryIndex lowest_power = size & (~size + 1u);
+
+      return lowest_power < DefaultAlignment ? lowest_power : DefaultAlignment;
+    }
+
+    static constexpr MemoryIndex BucketIndex(const MemoryIndex size, const MemoryIndex alignment) noexcept
+    {
+      if (size <= MaxPooledSize)
+      {
+        const MemoryIndex bucket = s_Lookup.bucket[(size + SizeClassGranularity - 1u) / SizeClassGranularity];
+
+        return alignment <= BucketAlignment(bucket) ? bucket : FallbackBucket;
+      }
+
+      return FallbackBucket;
+    }
+
+    /*!
+     * @param chunk_size
+     *   Each bucket fits as many blocks as it can into chunks of this size.
+     */
+    SizeClassPoolAllocator(IPolymorphicAllocator& parent_allocator, IPolymorphicAllocator& fallback_allocator, const MemoryIndex chunk_size = DefaultChunkSize) noexcept :
+      SizeClassPoolAllocator(parent_allocator, fallback_allocator, chunk_size, std::make_index_sequence<NumSizeClasses>{})
+    {
+    }
+
+    SizeClassPoolAllocator(const SizeClassPoolAllocator& rhs)            = delete;
+    SizeClassPoolAllocator(SizeClassPoolAllocator&& rhs)                 = delete;
+    SizeClassPoolAllocator& operator=(const SizeClassPoolAllocator& rhs) = delete;
+    SizeClassPoolAllocator& operator=(SizeClassPoolAllocator&& rhs)      = delete;
+
+    GrowingPoolAllocator&  Bucket(const MemoryIndex bucket) noexcept { return m_Buckets[bucket]; }
+    IPolymorphicAllocator& FallbackAllocator() const noexcept { return m_FallbackAllocator; }
+
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+    {
+      const MemoryIndex bucket = BucketIndex(size, alignment);
+
+      if (bucket != FallbackBucket)
+      {
+        return AllocateFromBucket(bucket, source_info);
+      }
+
+      return m_FallbackAllocator.Allocate(size, alignment, source_info);
+    }
+
+    void Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
+    {
+      const MemoryIndex bucket = BucketIndex(size, alignment);
+
+      if (bucket != FallbackBucket)
+      {
+        m_Buckets[bucket].Deallocate(ptr, BucketSize(bucket), BucketAlignment(bucket));
+      }
+      else
+      {
+        m_FallbackAllocator.Deallocate(ptr, size, alignment);
+      }
+    }
+
+    template<MemoryIndex Size, MemoryIndex Alignment>
+    AllocationResult Allocate(const AllocationSourceInfo& source_info) noexcept
+    {
+      constexpr MemoryIndex bucket = BucketIndex(Size, Alignment);
+
+      if constexpr (bucket != FallbackBucket)
+      {
+        return AllocateFromBucket(bucket, source_info);
+      }
+      else
+      {
+        return m_FallbackAllocator.Allocate(Size, Alignment, source_info);
+      }
+    }
+
+    template<MemoryIndex Size, MemoryIndex Alignment>
+    void Deallocate(void* const ptr) noexcept
+    {
+      constexpr MemoryIndex bucket = BucketIndex(Size, Alignment);
+
+      if constexpr (bucket != FallbackBucket)
+      {
+        m_Buckets[bucket].Deallocate(ptr, BucketSize(bucket), BucketAlignment(bucket));
+      }
+      else
+      {
+        m_FallbackAllocator.Deallocate(ptr, Size, Alignment);
+      }
+    }
+
+    // Sums the buckets, memory from the fallback allocator is not included.
+    void QueryStats(AllocatorStats& out_stats) const noexcept
+    {
+      out_stats = {};
+
+      for (const GrowingPoolAllocator& bucket : m_Buckets)
+      {
+        AllocatorStats bucket_stats;
+        bucket.QueryStats(bucket_stats);
+
+        out_stats.total_bytes += bucket_stats.total_bytes;
+        out_stats.used_bytes += bucket_stats.used_bytes;
+        out_stats.free_bytes += bucket_stats.free_bytes;
+        out_stats.overhead_bytes += bucket_stats.overhead_bytes;
+        out_stats.num_free_blocks += bucket_stats.num_free_blocks;
+        out_stats.largest_free_block = bucket_stats.largest_free_block > out_stats.largest_free_block ? bucket_stats.largest_free_block : out_stats.largest_free_block;
+      }
+    }
+
+    void Clear() noexcept
+    {
+      for (GrowingPoolAllocator& bucket : m_Buckets)
+      {
+        bucket.Clear();
+      }
+    }
+
+   private:
+    template<std::size_t... BucketIndices>
+    SizeClassPoolAllocator(IPolymorphicAllocator& parent_allocator, IPolymorphicAllocator& fallback_allocator, const MemoryIndex chunk_size, std::index_sequence<BucketIndices...>) noexcept :
+      m_Buckets{{parent_allocator, BucketSize(BucketIndices), BucketAlignment(BucketIndices), GrowingPoolAllocator::NumBlocksPerChunkForSize(BucketSize(BucketIndices), BucketAlignment(BucketIndices), chunk_size)}...},
+      m_FallbackAllocator{fallback_allocator}
+    {
+    }
+
+    // The reported size is the size class rather than the (possibly larger) aligned block
+    // so that `Deallocate` with any size up to it maps back to the same bucket.
+    AllocationResult AllocateFromBucket(const MemoryIndex bucket, const AllocationSourceInfo& source_info) noexcept
+    {
+      const AllocationResult result = m_Buckets[bucket].Allocate(BucketSize(bucket), BucketAlignment(bucket), source_info);
+
+      return result ? AllocationResult(result.ptr, BucketSize(bucket)) : AllocationResult::Null();
+    }
+  };
+
+  //-------------------------------------------------------------------------------------//
+  // Growing Linear Allocator: Like LinearAllocator except that it grows in chunks.
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   Linear (arena) allocator that requests a new chunk from the parent allocator
+   *   when the current one is full rather than failing.
+   *
+   *   Each new chunk is `growth_factor` times larger than the last (a factor of 1 is fixed size chunks),
+   *   allocations larger than the next chunk size get a chunk that fits them exactly.
+   *
+   *   `Clear` keeps the largest chunk around so that a per-frame reset does not
+   *   need to go back to the parent allocator once the allocator has warmed up.
+   */
+  class GrowingLinearAllocator
+  {
+    friend class GrowingLinearAllocatorSavePoint;
+
+   private:
+    struct ChunkHeader
+    {
+      ChunkHeader* prev;
+      MemoryIndex  size;  //!< Total size of the chunk including this header.
+      // byte[size - sizeof(ChunkHeader)];
+    };
+
+   private:
+    IPolymorphicAllocator& m_ParentAllocator;
+    MemoryIndex            m_ChunkSize;     //!< The size of the next chunk to be allocated.
+    MemoryIndex            m_GrowthFactor;  //!< How much to multiply `m_ChunkSize` after each chunk allocation.
+    ChunkHeader*           m_CurrentChunk;  //!< Newest chunk, older chunks are linked through `ChunkHeader::prev`.
+    ChunkHeader*           m_SpareChunk;    //!< Chunk released by a save point restore kept around for reuse.
+    byte*                  m_Current;
+    const byte*            m_ChunkEnd;
+
+   public:
+    GrowingLinearAllocator(
+     IPolymorphicAllocator& parent_allocator,
+     const MemoryIndex      initial_chunk_size,
+     const MemoryIndex      growth_factor = 2u) noexcept;
+
+    GrowingLinearAllocator(const GrowingLinearAllocator& rhs)            = delete;
+    GrowingLinearAllocator(GrowingLinearAllocator&& rhs)                 = delete;
+    GrowingLinearAllocator& operator=(const GrowingLinearAllocator& rhs) = delete;
+    GrowingLinearAllocator& operator=(GrowingLinearAllocator&& rhs)      = delete;
+
+    void             Clear() noexcept;
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept;
+    void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+    void             QueryStats(AllocatorStats& out_stats) const noexcept;  // The unused tails of older chunks count as used memory.
+    void             FreeMemory() noexcept;
+
+    ~GrowingLinearAllocator() noexcept { FreeMemory(); }
+
+   private:
+    static byte* ChunkBgn(ChunkHeader* const chunk) noexcept { return reinterpret_cast<byte*>(chunk) + sizeof(ChunkHeader); }
+    static byte* ChunkEnd(ChunkHeader* const chunk) noexcept { return reinterpret_cast<byte*>(chunk) + chunk->size; }
+
+    bool GrowChunk(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept;
+    void SetCurrentChunk(ChunkHeader* const chunk) noexcept;
+    void FreeChunk(ChunkHeader* const chunk) noexcept;
+    void ReleaseChunk(ChunkHeader* const chunk) noexcept;
+  };
+
+  /*!
+   * @brief
+   *   Same as `LinearAllocatorSavePoint` but restoring will also give back any chunks
+   *   allocated after the save was made.
+   */
+  class GrowingLinearAllocatorSavePoint
+  {
+   private:
+    GrowingLinearAllocator*              m_Allocator;     //!< The allocator to restore to.
+    GrowingLinearAllocator::ChunkHeader* m_RestoreChunk;  //!< The chunk `m_RestorePoint` is in.
+    byte*                                m_RestorePoint;  //!< The point in memory to go back to.
+
+   public:
+    void Save(GrowingLinearAllocator& allocator) noexcept;
+    void Restore() noexcept;
+  };
+
+  struct GrowingLinearAllocatorScope : private GrowingLinearAllocatorSavePoint
+  {
+    GrowingLinearAllocatorScope(GrowingLinearAllocator& allocator) noexcept :
+      GrowingLinearAllocatorSavePoint{}
+    {
+      Save(allocator);
+    }
+
+    GrowingLinearAllocatorScope(const GrowingLinearAllocatorScope& rhs) noexcept            = delete;
+    GrowingLinearAllocatorScope(GrowingLinearAllocatorScope&& rhs) noexcept                 = delete;
+    GrowingLinearAllocatorScope& operator=(const GrowingLinearAllocatorScope& rhs) noexcept = delete;
+    GrowingLinearAllocatorScope& operator=(GrowingLinearAllocatorScope&& rhs) noexcept      = delete;
+
+    ~GrowingLinearAllocatorScope() noexcept { Restore(); }
+  };
+
 }  // namespace Memory
 
 #endif  // LIB_FOUNDATION_MEMORY_GROWING_ST_ALLOCATORS_HPP
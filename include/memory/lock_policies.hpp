@@ -0,0 +1,186 @@
+/******************************************************************************/
+/*!
+ * @file   lock_policies.hpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Lock policies to be used with `Allocator<>` for making any `BaseAllocator` thread-safe.
+ *
+ *   Each policy is padded out to its own cache line so that the lock state
+ *   does not share a line with the `BaseAllocator` state it is mixed into.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#ifndef LIB_FOUNDATION_MEMORY_LOCK_POLICIES_HPP
+#define LIB_FOUNDATION_MEMORY_LOCK_POLICIES_HPP
+
+#include "alignment.hpp"  // CacheLineSize
+
+#include <atomic>   // atomic
+#include <cstdint>  // uint32_t, uint64_t
+#include <mutex>    // mutex
+
+namespace Memory
+{
+  /*!
+   * @brief
+   *   Hints to the CPU that the calling thread is in a spin wait loop (PAUSE / YIELD instruction).
+   */
+  void CpuRelax() noexcept;
+
+  /*!
+   * @brief
+   *   Counts the number of times a lock was already held when `Lock` was called,
+   *   shared by all the lock policies.
+   *
+   *   Compare against the allocation count to judge if a cheaper or fairer lock
+   *   would be better for a particular allocator.
+   */
+  class LockContentionCounter
+  {
+   private:
+    std::atomic<std::uint64_t> m_ContentionCount;
+
+   public:
+    LockContentionCounter() noexcept :
+      m_ContentionCount{0u}
+    {
+    }
+
+    std::uint64_t ContentionCount() const noexcept { return m_ContentionCount.load(std::memory_order_relaxed); }
+    void          ResetContentionCount() noexcept { m_ContentionCount.store(0u, std::memory_order_relaxed); }
+
+   protected:
+    void RecordContention() noexcept { m_ContentionCount.fetch_add(1u, std::memory_order_relaxed); }
+  };
+
+  /*!
+   * @brief
+   *   Test and test-and-set lock, contended waiters spin with an exponential
+   *   `CpuRelax` backoff before falling back to yielding their time slice.
+   *
+   *   Best for very short critical sections with low contention such as
+   *   wrapping a `PoolAllocator` or `LinearAllocator`.
+   */
+  struct alignas(CacheLineSize) SpinLock : public LockContentionCounter
+  {
+   private:
+    std::atomic<bool> m_IsLocked;
+
+   public:
+    SpinLock() noexcept :
+      LockContentionCounter(),
+      m_IsLocked{false}
+    {
+    }
+
+    void Lock() noexcept
+    {
+      if (m_IsLocked.exchange(true, std::memory_order_acquire))
+      {
+        LockSlow();
+      }
+    }
+
+    void Unlock() noexcept { m_IsLocked.store(false, std::memory_order_release); }
+
+   private:
+    void LockSlow() noexcept;
+  };
+
+  /*!
+   * @brief
+   *   Fair (FIFO) spin lock, threads are granted the lock in the order they called `Lock`.
+   *
+   *   Prevents starvation under heavy contention at the cost of every waiter
+   *   needing to be scheduled in turn, do not use with more threads than cores.
+   */
+  struct alignas(CacheLineSize) TicketLock : public LockContentionCounter
+  {
+   private:
+    std::atomic<std::uint32_t> m_NextTicket;
+    std::atomic<std::uint32_t> m_NowServing;
+
+   public:
+    TicketLock() noexcept :
+      LockContentionCounter(),
+      m_NextTicket{0u},
+      m_NowServing{0u}
+    {
+    }
+
+    void Lock() noexcept
+    {
+      const std::uint32_t ticket = m_NextTicket.fetch_add(1u, std::memory_order_relaxed);
+
+      if (m_NowServing.load(std::memory_order_acquire) != ticket)
+      {
+        LockSlow(ticket);
+      }
+    }
+
+    void Unlock() noexcept { m_NowServing.store(m_NowServing.load(std::memory_order_relaxed) + 1u, std::memory_order_release); }
+
+   private:
+    void LockSlow(const std::uint32_t ticket) noexcept;
+  };
+
+  /*!
+   * @brief
+   *   Wraps an OS backed `std::mutex`, waiters sleep rather than spin.
+   *
+   *   Best when the critical section may be long such as when the `BaseAllocator`
+   *   can go to the OS for more memory.
+   */
+  struct alignas(CacheLineSize) MutexLock : public LockContentionCounter
+  {
+   private:
+    std::mutex m_Mutex;
+
+   public:
+    MutexLock() noexcept :
+      LockContentionCounter(),
+      m_Mutex{}
+    {
+    }
+
+    void Lock() noexcept
+    {
+      if (!m_Mutex.try_lock())
+      {
+        RecordContention();
+        m_Mutex.lock();
+      }
+    }
+
+    void Unlock() noexcept { m_Mutex.unlock(); }
+  };
+}  // namespace Memory
+
+#endif  // LIB_FOUNDATION_MEMORY_LOCK_POLICIES_HPP
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
@@ -15,13 +15,22 @@
 #include "memory/allocation.hpp"  // Allocation API
 
 #include <iterator>     // make_reverse_iterator
-#include <memory>       // uninitialized_move
-#include <type_traits>  // is_trivially_destructible_v
+#include <memory>       // uninitialized_move, destroy
+#include <type_traits>  // is_trivially_destructible_v, is_trivially_copyable
 
 namespace bf
 {
+  /*!
+   * @brief
+   *   Whether a `T` can be moved to a new address with a `memcpy` and the old bytes
+   *   forgotten without running the destructor.
+   *
+   *   Defaults to trivially copyable types, specialize to `std::true_type` for types
+   *   that are relocatable but not trivially copyable (e.g. handles that own a resource
+   *   but do not point into themselves).
+   */
   template<typename T>
-  struct is_trivially_relocatable : public std::true_type
+  struct is_trivially_relocatable : public std::is_trivially_copyable<T>
   {
   };
 
@@ -59,6 +68,40 @@ DstIterator bfMemUninitializedMove(SrcIterator src_bgn, SrcIterator src_end, Dst
   return std::uninitialized_move(src_bgn, src_end, dst_bgn);
 }
 
+/*!
+ * @brief
+ *   Moves `[src_bgn, src_end)` into uninitialized memory at `dst_bgn` and ends the
+ *   lifetime of the source elements.
+ *
+ *   Trivially relocatable types are a single `memcpy` with no destructor calls,
+ *   otherwise each element is move constructed and then the source destroyed.
+ *
+ * @return
+ *   One past the last element relocated into.
+ */
+template<typename T>
+T* bfMemUninitializedRelocate(T* const src_bgn, T* const src_end, T* const dst_bgn)
+{
+  if constexpr (bf::is_trivially_relocatable_v<T>)
+  {
+    const std::size_t num_elements = src_end - src_bgn;
+
+    if (num_elements)
+    {
+      bfMemCopy(static_cast<void*>(dst_bgn), static_cast<const void*>(src_bgn), sizeof(T) * num_elements);
+    }
+
+    return dst_bgn + num_elements;
+  }
+  else
+  {
+    T* const dst_end = std::uninitialized_move(src_bgn, src_end, dst_bgn);
+    std::destroy(src_bgn, src_end);
+
+    return dst_end;
+  }
+}
+
 template<typename SrcIterator, typename DstIterator>
 DstIterator bfMemUninitializedMoveRev(SrcIterator src_bgn, SrcIterator src_end, DstIterator dst_end)
 {
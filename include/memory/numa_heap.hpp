@@ -0,0 +1,146 @@
+/******************************************************************************/
+/*!
+ * @file   numa_heap.hpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Page granular heaps that place their memory on a specific NUMA node,
+ *   meant to be the parent allocator of pools and arenas so their chunks
+ *   are local to the threads using them.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#ifndef LIB_FOUNDATION_MEMORY_NUMA_HEAP_HPP
+#define LIB_FOUNDATION_MEMORY_NUMA_HEAP_HPP
+
+#include "basic_types.hpp"  // AllocationResult, MemoryIndex, IPolymorphicAllocator
+
+#ifndef BF_MEMORY_MAX_NUMA_NODES
+#define BF_MEMORY_MAX_NUMA_NODES 64  //!< The number of nodes `NumaNodeHeap` has a heap for, any nodes past this are treated as node 0.
+#endif
+
+namespace Memory
+{
+  //-------------------------------------------------------------------------------------//
+  // NUMA Primitives
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   The number of NUMA nodes on this machine, 1 on systems without NUMA support.
+   */
+  MemoryIndex NumaNodeCount() noexcept;
+
+  /*!
+   * @brief
+   *   The node of the CPU the calling thread is currently running on.
+   *
+   *   Threads can migrate between CPUs so this is only a hint unless the
+   *   thread has been pinned to the CPUs of a single node.
+   */
+  MemoryIndex NumaCurrentNode() noexcept;
+
+  /*!
+   * @brief
+   *   Allocates committed pages that the OS will back with physical memory from \p node,
+   *   falling back to other nodes only once \p node is out of memory.
+   *
+   * @param size
+   *   The number of bytes to allocate, should be a multiple of `VirtualMemoryPageSize`.
+   *
+   * @param node
+   *   The preferred node, anything not less than `NumaNodeCount` gets the default OS placement.
+   *
+   * @return
+   *   Page aligned memory to be freed with `VirtualMemoryRelease`, nullptr on failure.
+   */
+  void* NumaMemoryAllocate(const MemoryIndex size, const MemoryIndex node) noexcept;
+
+  //-------------------------------------------------------------------------------------//
+  // NUMA Node Allocator
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   Allocates whole pages directly from the OS on a fixed node or on the
+   *   node of the calling thread.
+   *
+   *   Each allocation is rounded up to the page size so this should be the parent of
+   *   an allocator that requests large chunks (pools, arenas, thread caches)
+   *   rather than being used for individual objects.
+   *
+   *   There is no state besides the node so it is safe to use from multiple threads.
+   */
+  class NumaNodeAllocator
+  {
+   public:
+    static constexpr MemoryIndex CurrentNode = MemoryIndex(-1);  //!< Looks up the node of the calling thread on every allocation.
+
+   private:
+    MemoryIndex m_Node;
+
+   public:
+    NumaNodeAllocator(const MemoryIndex node = CurrentNode) noexcept;
+
+    MemoryIndex Node() const noexcept { return m_Node; }
+
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info */) const noexcept;
+    void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) const noexcept;
+  };
+
+  //-------------------------------------------------------------------------------------//
+  // NUMA Heaps
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   The heap for a specific \p node, for when the threads that will use
+   *   the memory are known ahead of time.
+   *
+   *   ```
+   *   GrowingPoolAllocator pool{Memory::NumaNodeHeap(worker_node), block_size, block_alignment, num_blocks_per_chunk};
+   *   ```
+   *
+   * @param node
+   *   Must be less than `BF_MEMORY_MAX_NUMA_NODES`.
+   */
+  IPolymorphicAllocator& NumaNodeHeap(const MemoryIndex node) noexcept;
+
+  /*!
+   * @brief
+   *   Heap that allocates from the node of the calling thread.
+   *
+   *   Best for allocators that are created and grown by the thread that uses them such as
+   *   a per thread pool or `ThreadCacheAllocator`.
+   */
+  IPolymorphicAllocator& NumaLocalHeap() noexcept;
+}  // namespace Memory
+
+#endif  // LIB_FOUNDATION_MEMORY_NUMA_HEAP_HPP
+
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
@@ -31,7 +31,7 @@ namespace bf
     T*          buffer;
     std::size_t num_elements;
 
-    ScopedBuffer(IPolymorphicAllocator& memory = Memory::DefaultHeap(), std::size_t in_num_elements = 0u) :
+    ScopedBuffer(IPolymorphicAllocator& memory, std::size_t in_num_elements = 0u) :
       memory{memory},
       buffer{nullptr},
       num_elements{0u}
@@ -39,6 +39,13 @@ namespace bf
       resize(in_num_elements);
     }
 
+#if !BF_MEMORY_NO_DEFAULT_HEAP
+    ScopedBuffer() :
+      ScopedBuffer(Memory::DefaultHeap())
+    {
+    }
+#endif
+
     // TODO(SR): Implement move and copy. (disabled for now)
     ScopedBuffer(const ScopedBuffer& rhs)            = delete;
     ScopedBuffer& operator=(const ScopedBuffer& rhs) = delete;
@@ -67,26 +74,53 @@ namespace bf
     template<Memory::ArrayConstruct new_element_init = Memory::ArrayConstruct::UNINITIALIZE>
     bool resize(const std::size_t new_size)
     {
-      if (num_elements != new_size)
+      const std::size_t num_live_elements = num_elements < new_size ? num_elements : new_size;
+
+      if (num_elements != new_size && relocate(new_size, num_live_elements))
       {
-        T* const new_buffer = bfMemAllocateArray<T, Memory::ArrayConstruct::UNINITIALIZE>(memory, new_size);
+        const std::size_t num_new_elements = new_size - num_live_elements;
+
+        bfMemArrayConstruct<T, new_element_init>({buffer + num_live_elements, num_new_elements * sizeof(T)}, num_new_elements);
 
-        if (new_buffer || new_size == 0u)
-        {
-          const std::size_t num_move_elements   = num_elements < new_size ? num_elements : new_size;
-          T* const          new_buffer_move_end = std::uninitialized_move(buffer, buffer + num_move_elements, new_buffer);
-          bfMemDeallocateArray(memory, buffer, num_elements);
+        return true;
+      }
 
-          const T* const    new_buffer_end   = new_buffer + new_size;
-          const std::size_t num_new_elements = (new_buffer_end - new_buffer_move_end);
+      return false;
+    }
+
+    //
+    // Changes the size of the buffer keeping only the first `num_live_elements`,
+    // the rest of the new buffer is left uninitialized.
+    // Returns true on success.
+    //
+    bool relocate(const std::size_t new_size, const std::size_t num_live_elements)
+    {
+      bfMemAssert(num_live_elements <= num_elements && num_live_elements <= new_size, "Cannot keep more elements than there are.");
 
-          bfMemArrayConstruct<T, new_element_init>({new_buffer_move_end, num_new_elements * sizeof(T)}, num_new_elements);
+      if (num_elements == new_size)
+      {
+        return true;
+      }
+
+      // Growing / shrinking in place avoids moving every element.
+      if (buffer && new_size != 0u && (bfMemResize)(memory, buffer, sizeof(T) * num_elements, sizeof(T) * new_size, alignof(T), MemoryMakeAllocationSourceInfo()))
+      {
+        num_elements = new_size;
+
+        return true;
+      }
+
+      T* const new_buffer = bfMemAllocateArray<T, Memory::ArrayConstruct::UNINITIALIZE>(memory, new_size);
+
+      if (new_buffer || new_size == 0u)
+      {
+        bfMemUninitializedRelocate(buffer, buffer + num_live_elements, new_buffer);
+        bfMemDeallocateArray(memory, buffer, num_elements);
 
-          num_elements = new_size;
-          buffer       = new_buffer;
+        num_elements = new_size;
+        buffer       = new_buffer;
 
-          return true;
-        }
+        return true;
       }
 
       return false;
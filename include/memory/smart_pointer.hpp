@@ -11,12 +11,14 @@
 #ifndef LIB_FOUNDATION_MEMORY_SMART_POINTER_HPP
 #define LIB_FOUNDATION_MEMORY_SMART_POINTER_HPP
 
+#include "memory/alignment.hpp"      // AlignSize
 #include "memory/allocation.hpp"     // IPolymorphicAllocator, bfMemAllocateArray, bfMemDeallocateArray, bfMemAllocateObject, bfMemDeallocateObject
 #include "memory/stl_allocator.hpp"  // StlAllocator
 
+#include <cstdint>      // uint32_t
 #include <memory>       // shared_ptr, allocate_shared, unique_ptr
 #include <type_traits>  // is_array_v, is_bounded_array_v, is_unbounded_array_v, enable_if_t
-#include <utility>      // move, exchange
+#include <utility>      // move, exchange, swap
 
 #if defined(_MSC_VER)
 #define IS_CXX20 (_MSVC_LANG >= 202002L)  // Unless `/Zc:__cplusplus` is specified `__cplusplus` has an incorrect value of `199711L` on msvc. (_MSVC_LANG is vs2015 and up)
@@ -291,6 +293,337 @@ UniquePtr<T> bfMemMakeUnique(AllocatorConcept* const allocator)
   return result;
 }
 
+namespace Memory
+{
+  /*!
+   * @brief
+   *   Deleter for a single object from a statically typed allocator, the object
+   *   needs no header since the allocator and size are known from the types.
+   */
+  template<typename T, typename AllocatorConcept>
+  struct AllocatorDeleter
+  {
+    AllocatorConcept* allocator;
+
+    void operator()(T* const ptr) const noexcept { bfMemDeallocateObject(*allocator, ptr); }
+  };
+
+  /*!
+   * @brief
+   *   Like `AllocatorDeleter` but for a global / singleton allocator returned from
+   *   `GetAllocator()` so the deleter is empty and the pointer is the size of a `T*`.
+   */
+  template<typename T, auto GetAllocator>
+  struct StaticAllocatorDeleter
+  {
+    void operator()(T* const ptr) const noexcept { bfMemDeallocateObject(GetAllocator(), ptr); }
+  };
+}  // namespace Memory
+
+/*!
+ * @brief
+ *   Header free alternatives to `UniquePtr` for single objects.
+ *
+ *   `UniquePtr` prefixes every allocation with a `UniquePtrHeader` and destroys through
+ *   a function pointer so any allocator can be used through one type. When the allocator
+ *   type is known there is no per object overhead and destruction is a direct call.
+ *
+ *   Unlike `UniquePtr` these do not convert to a pointer of a base class
+ *   since the size passed to the allocator comes from `T`.
+ *
+ *   ```
+ *   AllocatorUniquePtr<Foo, ObjectPool<Foo, 64>> foo = bfMemMakeUniqueIn<Foo>(&pool, args...);
+ *   StaticUniquePtr<Foo, &Memory::DefaultHeap>   bar = bfMemMakeUniqueStatic<Foo, &Memory::DefaultHeap>(args...);
+ *   ```
+ */
+template<typename T, typename AllocatorConcept>
+using AllocatorUniquePtr = std::unique_ptr<T, Memory::AllocatorDeleter<T, AllocatorConcept>>;
+
+template<typename T, auto GetAllocator>
+using StaticUniquePtr = std::unique_ptr<T, Memory::StaticAllocatorDeleter<T, GetAllocator>>;
+
+template<typename T, typename AllocatorConcept, typename = std::enable_if_t<!std::is_array_v<T>>, typename... Args>
+AllocatorUniquePtr<T, AllocatorConcept> bfMemMakeUniqueIn(AllocatorConcept* const allocator, Args&&... args)
+{
+  return AllocatorUniquePtr<T, AllocatorConcept>(bfMemAllocateObject<T>(*allocator, std::forward<Args>(args)...), Memory::AllocatorDeleter<T, AllocatorConcept>{allocator});
+}
+
+template<typename T, auto GetAllocator, typename = std::enable_if_t<!std::is_array_v<T>>, typename... Args>
+StaticUniquePtr<T, GetAllocator> bfMemMakeUniqueStatic(Args&&... args)
+{
+  return StaticUniquePtr<T, GetAllocator>(bfMemAllocateObject<T>(GetAllocator(), std::forward<Args>(args)...));
+}
+
+namespace Memory
+{
+  /*!
+   * @brief
+   *   This prefixes all allocations made from `bfMemMakeLocalShared`.
+   *
+   *   The count and the objects share one allocation so a `LocalSharedPtr<T>`
+   *   is a single pointer and the block size is known up front,
+   *   see `LocalSharedPtrBlockSize` for sizing pools.
+   */
+  struct LocalSharedPtrHeader
+  {
+    using DestroyFn = void (*)(LocalSharedPtrHeader* const header);
+
+    void*         allocator;
+    DestroyFn     destroy;
+    std::uint32_t ref_count;
+    std::uint32_t num_objects;
+  };
+
+  template<typename T>
+  inline constexpr MemoryIndex LocalSharedPtrAlignment = alignof(std::remove_extent_t<T>) < alignof(LocalSharedPtrHeader) ? alignof(LocalSharedPtrHeader) : alignof(std::remove_extent_t<T>);
+
+  template<typename T>
+  inline constexpr MemoryIndex LocalSharedPtrHeaderSize = AlignSize(sizeof(LocalSharedPtrHeader), LocalSharedPtrAlignment<T>);
+
+  /*!
+   * @brief
+   *   The number of bytes a `bfMemMakeLocalShared<T>` allocation requests,
+   *   use as the block size of a pool dedicated to `LocalSharedPtr<T>`.
+   */
+  template<typename T>
+  constexpr MemoryIndex LocalSharedPtrBlockSize(const MemoryIndex num_objects = is_bounded_array_v<T> ? std::extent_v<T> : 1u) noexcept
+  {
+    return LocalSharedPtrHeaderSize<T> + num_objects * sizeof(std::remove_extent_t<T>);
+  }
+}  // namespace Memory
+
+template<typename T>
+class LocalSharedPtr;
+
+namespace Memory
+{
+  template<typename T, typename AllocatorConcept>
+  LocalSharedPtr<T> MakeLocalSharedImpl(AllocatorConcept* const allocator, const MemoryIndex num_objects);
+}  // namespace Memory
+
+/*!
+ * @brief
+ *   A shared pointer with a non-atomic reference count stored in front of the
+ *   object(s) in the same allocation.
+ *
+ *   Compared to `SharedPtr` (`std::shared_ptr`):
+ *     - Only safe to copy / destroy from one thread at a time.
+ *     - One allocation for the count and the objects, including `T[]`.
+ *     - The size of a single pointer with no separate control block.
+ *     - No weak references, aliasing or conversion to a pointer of a base class.
+ *     - `bfMemLocalSharedFromThis` recovers a `LocalSharedPtr` from a raw pointer since the count is intrusive.
+ *
+ * @tparam T
+ *   The type of object stored in this pointer, may be `T[]` or `T[N]`.
+ */
+template<typename T>
+class LocalSharedPtr
+{
+  template<typename U, typename AllocatorConcept>
+  friend LocalSharedPtr<U> Memory::MakeLocalSharedImpl(AllocatorConcept* const allocator, const MemoryIndex num_objects);
+
+  template<typename U>
+  friend LocalSharedPtr<U> bfMemLocalSharedFromThis(U* const ptr) noexcept;
+
+ public:
+  using element_type = std::remove_extent_t<T>;
+
+ private:
+  Memory::LocalSharedPtrHeader* m_Header;
+
+ public:
+  constexpr LocalSharedPtr(std::nullptr_t = nullptr) noexcept :
+    m_Header{nullptr}
+  {
+  }
+
+  LocalSharedPtr(const LocalSharedPtr& rhs) noexcept :
+    m_Header{rhs.m_Header}
+  {
+    Acquire();
+  }
+
+  LocalSharedPtr(LocalSharedPtr&& rhs) noexcept :
+    m_Header{std::exchange(rhs.m_Header, nullptr)}
+  {
+  }
+
+  LocalSharedPtr& operator=(const LocalSharedPtr& rhs) noexcept
+  {
+    LocalSharedPtr(rhs).swap(*this);
+    return *this;
+  }
+
+  LocalSharedPtr& operator=(LocalSharedPtr&& rhs) noexcept
+  {
+    LocalSharedPtr(std::move(rhs)).swap(*this);
+    return *this;
+  }
+
+  element_type* get() const noexcept { return m_Header ? reinterpret_cast<element_type*>(reinterpret_cast<byte*>(m_Header) + Memory::LocalSharedPtrHeaderSize<T>) : nullptr; }
+  MemoryIndex   length() const noexcept { return m_Header ? m_Header->num_objects : 0u; }
+  MemoryIndex   use_count() const noexcept { return m_Header ? m_Header->ref_count : 0u; }
+  element_type* begin() const noexcept { return get(); }
+  element_type* end() const noexcept { return get() + length(); }
+
+  template<typename U = T, typename = std::enable_if_t<!std::is_array_v<U>>>
+  U& operator*() const noexcept
+  {
+    return *get();
+  }
+
+  template<typename U = T, typename = std::enable_if_t<!std::is_array_v<U>>>
+  U* operator->() const noexcept
+  {
+    return get();
+  }
+
+  template<typename U = T, typename = std::enable_if_t<std::is_array_v<U>>>
+  element_type& operator[](const MemoryIndex index) const noexcept
+  {
+    bfMemAssert(index < length(), "Index out of bounds.");
+    return get()[index];
+  }
+
+  explicit operator bool() const noexcept { return m_Header != nullptr; }
+  bool     operator==(std::nullptr_t) const noexcept { return m_Header == nullptr; }
+  bool     operator!=(std::nullptr_t) const noexcept { return m_Header != nullptr; }
+  bool     operator==(const LocalSharedPtr& rhs) const noexcept { return m_Header == rhs.m_Header; }
+  bool     operator!=(const LocalSharedPtr& rhs) const noexcept { return m_Header != rhs.m_Header; }
+
+  void reset() noexcept { LocalSharedPtr().swap(*this); }
+  void swap(LocalSharedPtr& rhs) noexcept { std::swap(m_Header, rhs.m_Header); }
+
+  ~LocalSharedPtr() noexcept { Release(); }
+
+ private:
+  explicit LocalSharedPtr(Memory::LocalSharedPtrHeader* const header) noexcept :
+    m_Header{header}
+  {
+  }
+
+  void Acquire() const noexcept
+  {
+    if (m_Header)
+    {
+      ++m_Header->ref_count;
+    }
+  }
+
+  void Release() noexcept
+  {
+    if (m_Header && --m_Header->ref_count == 0u)
+    {
+      m_Header->destroy(m_Header);
+    }
+  }
+};
+
+namespace Memory
+{
+  /*!
+   * @brief
+   *   Allocates the header and uninitialized storage for \p num_objects, the
+   *   reference count starts at one and destruction covers all \p num_objects
+   *   so the caller must construct every object.
+   */
+  template<typename T, typename AllocatorConcept>
+  LocalSharedPtr<T> MakeLocalSharedImpl(AllocatorConcept* const allocator, const MemoryIndex num_objects)
+  {
+    using object_type = std::remove_extent_t<T>;
+
+    static constexpr MemoryIndex alignment = LocalSharedPtrAlignment<T>;
+
+    bfMemAssert(num_objects <= MemoryIndex(std::uint32_t(-1)), "Too many objects for a LocalSharedPtr.");
+
+    const MemoryIndex total_size = LocalSharedPtrBlockSize<T>(num_objects);
+
+    if (void* const allocation = bfMemAllocate(*allocator, total_size, alignment).ptr; allocation != nullptr)
+    {
+      LocalSharedPtrHeader* const header = static_cast<LocalSharedPtrHeader*>(allocation);
+
+      header->allocator   = allocator;
+      header->ref_count   = 1u;
+      header->num_objects = std::uint32_t(num_objects);
+      header->destroy     = +[](LocalSharedPtrHeader* const header) {
+        object_type* const objects = reinterpret_cast<object_type*>(reinterpret_cast<byte*>(header) + LocalSharedPtrHeaderSize<T>);
+
+        DestructRange(objects, objects + header->num_objects);
+        bfMemDeallocate(*static_cast<AllocatorConcept*>(header->allocator), header, LocalSharedPtrBlockSize<T>(header->num_objects), alignment);
+      };
+
+      return LocalSharedPtr<T>(header);
+    }
+
+    return nullptr;
+  }
+}  // namespace Memory
+
+template<typename T, typename AllocatorConcept, typename = std::enable_if_t<!std::is_array_v<T>>, typename... Args>
+LocalSharedPtr<T> bfMemMakeLocalShared(AllocatorConcept* const allocator, Args&&... args)
+{
+  LocalSharedPtr<T> result = Memory::MakeLocalSharedImpl<T>(allocator, 1u);
+
+  if (result)
+  {
+    Memory::Construct<T>(result.get(), std::forward<Args>(args)...);
+  }
+
+  return result;
+}
+
+template<typename T, typename AllocatorConcept, typename = std::enable_if_t<Memory::is_unbounded_array_v<T>>>
+LocalSharedPtr<T> bfMemMakeLocalShared(AllocatorConcept* const allocator, const MemoryIndex num_elements)
+{
+  LocalSharedPtr<T> result = Memory::MakeLocalSharedImpl<T>(allocator, num_elements);
+
+  if (result)
+  {
+    Memory::DefaultConstructRange(result.get(), result.get() + num_elements);
+  }
+
+  return result;
+}
+
+template<typename T, typename AllocatorConcept, typename = std::enable_if_t<Memory::is_bounded_array_v<T>>>
+LocalSharedPtr<T> bfMemMakeLocalShared(AllocatorConcept* const allocator)
+{
+  constexpr MemoryIndex num_elements = std::extent_v<T>;
+  LocalSharedPtr<T>     result       = Memory::MakeLocalSharedImpl<T>(allocator, num_elements);
+
+  if (result)
+  {
+    Memory::DefaultConstructRange(result.get(), result.get() + num_elements);
+  }
+
+  return result;
+}
+
+/*!
+ * @brief
+ *   Creates another owner of an object made by `bfMemMakeLocalShared<T>`
+ *   from a pointer to it, such as `this` inside of a member function.
+ *
+ * @param ptr
+ *   Must be the result of `LocalSharedPtr<T>::get` with the same non array `T` while still alive.
+ */
+template<typename T>
+LocalSharedPtr<T> bfMemLocalSharedFromThis(T* const ptr) noexcept
+{
+  static_assert(!std::is_array_v<T>, "Only single objects can be recovered from a pointer.");
+
+  if (ptr)
+  {
+    Memory::LocalSharedPtrHeader* const header = reinterpret_cast<Memory::LocalSharedPtrHeader*>(reinterpret_cast<byte*>(const_cast<std::remove_cv_t<T>*>(ptr)) - Memory::LocalSharedPtrHeaderSize<T>);
+
+    ++header->ref_count;
+
+    return LocalSharedPtr<T>(header);
+  }
+
+  return nullptr;
+}
+
 #undef IS_CXX20
 
 namespace Memory
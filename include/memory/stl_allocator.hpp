@@ -19,6 +19,7 @@
 #include "allocation.hpp"           // IPolymorphicAllocator, bfMemAllocateArray, bfMemDeallocateArray
 #include "memory/default_heap.hpp"  // DefaultHeap
 
+#include <memory>   // allocation_result
 #include <utility>  // forward
 
 namespace Memory
@@ -92,6 +93,22 @@ namespace Memory
        constexpr operator==
   */
 
+#if defined(__cpp_lib_allocate_at_least)
+  template<typename Pointer, typename SizeType = std::size_t>
+  using StlAllocationResult = std::allocation_result<Pointer, SizeType>;
+#else
+  /*!
+   * @brief
+   *   Stand in for C++23's `std::allocation_result` so containers can use the size feedback before C++23.
+   */
+  template<typename Pointer, typename SizeType = std::size_t>
+  struct StlAllocationResult
+  {
+    Pointer  ptr;
+    SizeType count;
+  };
+#endif
+
   /*!
    * @brief
    *   Provides an STL compliant proxy for the IPolymorphicAllocator API.
@@ -121,7 +138,7 @@ namespace Memory
     template<class U>
     struct rebind
     {
-      using other = StlAllocator<U>;
+      using other = StlAllocator<U, AllocatorConcept>;
     };
 
    private:
@@ -140,13 +157,33 @@ namespace Memory
       static_assert(std::is_convertible_v<RhsAllocatorConcept *, AllocatorConcept *>, "Allocator types not convertable.");
     }
 
-    static [[nodiscard]] size_type max_size() noexcept { return static_cast<size_type>(-1) / sizeof(value_type); }
+    [[nodiscard]] static size_type max_size() noexcept { return static_cast<size_type>(-1) / sizeof(value_type); }
 
     [[nodiscard]] pointer           address(reference x) const noexcept { return &x; }
     [[nodiscard]] const_pointer     address(const_reference x) const noexcept { return &x; }
     [[nodiscard]] constexpr pointer allocate(size_type s) { return s ? bfMemAllocateArray<T>(m_MemoryBackend, s) : nullptr; }
     constexpr void                  deallocate(pointer p, size_type s) { bfMemDeallocateArray(m_MemoryBackend, p, s); }
 
+    /*!
+     * @brief
+     *   Like `allocate` but reports any extra elements that fit in the block the backend
+     *   handed out (e.g. a whole pool block), `deallocate` may be called with either count.
+     */
+    [[nodiscard]] constexpr StlAllocationResult<pointer, size_type> allocate_at_least(size_type s)
+    {
+      if (s)
+      {
+        const AllocationResult mem_block = bfMemAllocate(m_MemoryBackend, sizeof(T) * s, alignof(T));
+
+        if (mem_block)
+        {
+          return {static_cast<pointer>(mem_block.ptr), mem_block.num_bytes / sizeof(T)};
+        }
+      }
+
+      return {nullptr, 0u};
+    }
+
     template<class U, class... Args>
     void construct(U *const p, Args &&...args)
     {
@@ -162,19 +199,114 @@ namespace Memory
     [[nodiscard]] StlAllocator select_on_container_copy_construction() const noexcept { return *this; }
 
     template<class U>
-    [[nodiscard]] constexpr bool operator==(const StlAllocator<U> &rhs) const noexcept
+    [[nodiscard]] constexpr bool operator==(const StlAllocator<U, AllocatorConcept> &rhs) const noexcept
     {
       return &backend() == &rhs.backend();
     }
 
     template<class U>
-    [[nodiscard]] constexpr bool operator!=(const StlAllocator<U> &rhs) const noexcept
+    [[nodiscard]] constexpr bool operator!=(const StlAllocator<U, AllocatorConcept> &rhs) const noexcept
     {
       return &backend() != &rhs.backend();
     }
 
     AllocatorConcept &backend() const { return m_MemoryBackend; }
   };
+
+  /*!
+   * @brief
+   *   STL allocator for arenas such as `LinearAllocator`, memory is reclaimed all at once
+   *   by clearing / rewinding the arena rather than per element.
+   *
+   *   - Calls go straight to `ArenaConcept` so there is no polymorphic dispatch,
+   *     rebinding (e.g. to a node type) keeps the concrete arena type.
+   *   - `deallocate` is a no-op so container teardown does not touch the arena.
+   *   - The arena propagates on move assignment and swap so moving a container
+   *     is always O(1) even between containers on different arenas.
+   *
+   * @tparam T
+   *   The type of object this allocated expects to make memory for.
+   *
+   * @tparam ArenaConcept
+   *   Allocator the memory comes from, must outlive any container using it.
+   */
+  template<typename T, typename ArenaConcept>
+  class ArenaStlAllocator
+  {
+    template<typename U, typename RhsArenaConcept>
+    friend class ArenaStlAllocator;
+
+   public:
+    using value_type                             = T;
+    using size_type                              = std::size_t;
+    using difference_type                        = std::ptrdiff_t;
+    using is_always_equal                        = std::false_type;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    template<class U>
+    struct rebind
+    {
+      using other = ArenaStlAllocator<U, ArenaConcept>;
+    };
+
+   private:
+    ArenaConcept *m_Arena;  //!< Pointer rather than reference so the allocator can be assigned when propagated.
+
+   public:
+    ArenaStlAllocator(ArenaConcept &arena) noexcept :
+      m_Arena{&arena}
+    {
+    }
+
+    template<class U>
+    ArenaStlAllocator(const ArenaStlAllocator<U, ArenaConcept> &rhs) noexcept :
+      m_Arena{rhs.m_Arena}
+    {
+    }
+
+    [[nodiscard]] static size_type max_size() noexcept { return static_cast<size_type>(-1) / sizeof(value_type); }
+
+    [[nodiscard]] T *allocate(size_type s) { return s ? bfMemAllocateArray<T>(*m_Arena, s) : nullptr; }
+
+    void deallocate(T *const p, size_type s) noexcept
+    {
+      (void)p;
+      (void)s;
+    }
+
+    [[nodiscard]] StlAllocationResult<T *, size_type> allocate_at_least(size_type s)
+    {
+      if (s)
+      {
+        const AllocationResult mem_block = bfMemAllocate(*m_Arena, sizeof(T) * s, alignof(T));
+
+        if (mem_block)
+        {
+          return {static_cast<T *>(mem_block.ptr), mem_block.num_bytes / sizeof(T)};
+        }
+      }
+
+      return {nullptr, 0u};
+    }
+
+    [[nodiscard]] ArenaStlAllocator select_on_container_copy_construction() const noexcept { return *this; }
+
+    template<class U>
+    [[nodiscard]] constexpr bool operator==(const ArenaStlAllocator<U, ArenaConcept> &rhs) const noexcept
+    {
+      return m_Arena == rhs.m_Arena;
+    }
+
+    template<class U>
+    [[nodiscard]] constexpr bool operator!=(const ArenaStlAllocator<U, ArenaConcept> &rhs) const noexcept
+    {
+      return m_Arena != rhs.m_Arena;
+    }
+
+    ArenaConcept &backend() const { return *m_Arena; }
+  };
 }  // namespace Memory
 
 #endif  // LIB_FOUNDATION_MEMORY_STL_ALLOCATOR_HPP
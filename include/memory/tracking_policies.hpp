@@ -0,0 +1,655 @@
+/******************************************************************************/
+/*!
+ * @file   tracking_policies.hpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Allocation tracking policies to be used with `Allocator<>` for
+ *   finding out where and how memory is being used.
+ *
+ *   Tracking calls are made with the `Allocator<>`'s `LockPolicy` held so
+ *   policies do not need to do any synchronization of their own, querying
+ *   a policy while other threads are allocating requires holding that lock.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#ifndef LIB_FOUNDATION_MEMORY_TRACKING_POLICIES_HPP
+#define LIB_FOUNDATION_MEMORY_TRACKING_POLICIES_HPP
+
+#include "basic_types.hpp"  // MemoryTrackAllocate, MemoryTrackDeallocate, AllocationSourceInfo
+
+#include <cstdint>  // uint64_t, int64_t, uint32_t, uint16_t, uint8_t
+#include <cstdio>   // FILE
+
+#ifndef BF_MEMORY_TRACE_MAX_CALL_SITES
+#define BF_MEMORY_TRACE_MAX_CALL_SITES 4096  //!< Unique call sites `MemoryTraceInternCallSite` can hand out ids for, must be a power of two below 65536.
+#endif
+
+namespace Memory
+{
+  //-------------------------------------------------------------------------------------//
+  // Statistics Tracking
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   Global counters kept by `StatisticsMemoryTracking`.
+   *
+   *   Sizes are the number of bytes requested from the `BaseAllocator`
+   *   which includes any bounds checking overhead added by `Allocator<>`.
+   */
+  struct MemoryStatistics
+  {
+    static constexpr MemoryIndex NumSizeBuckets = 32u;
+
+    MemoryIndex   live_bytes;
+    MemoryIndex   peak_live_bytes;
+    MemoryIndex   live_allocations;
+    std::uint64_t total_allocations;
+    std::uint64_t total_deallocations;
+    std::uint64_t total_bytes_allocated;
+    std::uint64_t untracked_call_site_allocations;  //!< Allocations not attributed to a call site because the call site table was full.
+    std::uint64_t size_histogram[NumSizeBuckets];   //!< Bucket `i` counts allocations where `2^(i-1) <= size < 2^i`, bucket 0 counts zero sized requests.
+  };
+
+  struct MemoryCallSiteStatistics
+  {
+    AllocationSourceInfo source_info;
+    std::uint64_t        num_allocations;
+    std::uint64_t        num_bytes_allocated;
+  };
+
+  /*!
+   * @brief
+   *   Returns the `MemoryStatistics::size_histogram` bucket for an allocation of \p size bytes.
+   */
+  MemoryIndex MemoryStatisticsSizeBucket(const MemoryIndex size) noexcept;
+
+  /*!
+   * @brief
+   *   Hashes the pointer values (not the string contents) of \p source_info.
+   */
+  MemoryIndex MemoryCallSiteHash(const AllocationSourceInfo& source_info) noexcept;
+
+  /*!
+   * @brief
+   *   Returns true if both source infos are from the same call site,
+   *   compares the file and function by pointer.
+   */
+  bool MemoryIsSameCallSite(const AllocationSourceInfo& lhs, const AllocationSourceInfo& rhs) noexcept;
+
+  /*!
+   * @brief
+   *   Tracking policy that keeps live / peak byte counts, allocation counts and a size histogram.
+   *
+   *   Allocations are also aggregated per call site in a fixed capacity open addressing hash table,
+   *   nothing is allocated by the policy itself so it is safe on any allocator.
+   *
+   *   Deallocations do not carry a call site so per call site counters only ever grow.
+   *
+   * @tparam CallSiteCapacity
+   *   Max number of unique call sites recorded, must be a power of two.
+   */
+  template<MemoryIndex CallSiteCapacity = 256u>
+  class StatisticsMemoryTracking
+  {
+    static_assert(CallSiteCapacity > 0u && (CallSiteCapacity & (CallSiteCapacity - 1u)) == 0u, "CallSiteCapacity must be a power of two.");
+
+   private:
+    MemoryStatistics         m_Statistics;
+    MemoryIndex              m_NumCallSites;
+    MemoryCallSiteStatistics m_CallSites[CallSiteCapacity];  //!< Slots with a `num_allocations` of 0 are empty.
+
+   public:
+    StatisticsMemoryTracking() noexcept :
+      m_Statistics{},
+      m_NumCallSites{0u},
+      m_CallSites{}
+    {
+    }
+
+    void TrackAllocate(const MemoryTrackAllocate& allocate_info) noexcept
+    {
+      const MemoryIndex size = allocate_info.requested_bytes;
+
+      m_Statistics.live_bytes += size;
+      m_Statistics.live_allocations += 1u;
+      m_Statistics.total_allocations += 1u;
+      m_Statistics.total_bytes_allocated += size;
+      m_Statistics.size_histogram[MemoryStatisticsSizeBucket(size)] += 1u;
+
+      if (m_Statistics.live_bytes > m_Statistics.peak_live_bytes)
+      {
+        m_Statistics.peak_live_bytes = m_Statistics.live_bytes;
+      }
+
+      MemoryCallSiteStatistics* const call_site = FindOrAddCallSite(allocate_info.source_info);
+
+      if (call_site)
+      {
+        call_site->num_allocations += 1u;
+        call_site->num_bytes_allocated += size;
+      }
+      else
+      {
+        m_Statistics.untracked_call_site_allocations += 1u;
+      }
+    }
+
+    void TrackDeallocate(const MemoryTrackDeallocate& deallocate_info) noexcept
+    {
+      m_Statistics.live_bytes -= deallocate_info.num_bytes;
+      m_Statistics.live_allocations -= 1u;
+      m_Statistics.total_deallocations += 1u;
+    }
+
+    // Query API
+
+    const MemoryStatistics& Statistics() const noexcept { return m_Statistics; }
+    MemoryIndex             NumCallSites() const noexcept { return m_NumCallSites; }
+
+    /*!
+     * @brief
+     *   Calls \p callback with a `const MemoryCallSiteStatistics&` for each recorded call site in no particular order.
+     */
+    template<typename F>
+    void ForEachCallSite(F&& callback) const
+    {
+      for (const MemoryCallSiteStatistics& call_site : m_CallSites)
+      {
+        if (call_site.num_allocations != 0u)
+        {
+          callback(call_site);
+        }
+      }
+    }
+
+    /*!
+     * @brief
+     *   Copies up to \p out_capacity call sites into \p out_call_sites.
+     *
+     * @return
+     *   The number of call sites written.
+     */
+    MemoryIndex SnapshotCallSites(MemoryCallSiteStatistics* const out_call_sites, const MemoryIndex out_capacity) const noexcept
+    {
+      MemoryIndex num_written = 0u;
+
+      for (const MemoryCallSiteStatistics& call_site : m_CallSites)
+      {
+        if (num_written == out_capacity)
+        {
+          break;
+        }
+
+        if (call_site.num_allocations != 0u)
+        {
+          out_call_sites[num_written++] = call_site;
+        }
+      }
+
+      return num_written;
+    }
+
+    /*!
+     * @brief
+     *   Clears the call site table and all counters except the live ones.
+     */
+    void ResetStatistics() noexcept
+    {
+      const MemoryIndex live_bytes       = m_Statistics.live_bytes;
+      const MemoryIndex live_allocations = m_Statistics.live_allocations;
+
+      m_Statistics                  = {};
+      m_Statistics.live_bytes       = live_bytes;
+      m_Statistics.peak_live_bytes  = live_bytes;
+      m_Statistics.live_allocations = live_allocations;
+
+      for (MemoryCallSiteStatistics& call_site : m_CallSites)
+      {
+        call_site = {};
+      }
+      m_NumCallSites = 0u;
+    }
+
+   private:
+    MemoryCallSiteStatistics* FindOrAddCallSite(const AllocationSourceInfo& source_info) noexcept
+    {
+      const MemoryIndex mask  = CallSiteCapacity - 1u;
+      MemoryIndex       index = MemoryCallSiteHash(source_info) & mask;
+
+      for (MemoryIndex probe = 0u; probe < CallSiteCapacity; ++probe)
+      {
+        MemoryCallSiteStatistics& call_site = m_CallSites[index];
+
+        if (call_site.num_allocations == 0u)
+        {
+          call_site.source_info = source_info;
+          ++m_NumCallSites;
+          return &call_site;
+        }
+
+        if (MemoryIsSameCallSite(call_site.source_info, source_info))
+        {
+          return &call_site;
+        }
+
+        index = (index + 1u) & mask;
+      }
+
+      return nullptr;
+    }
+  };
+
+  //-------------------------------------------------------------------------------------//
+  // Sampling Tracking
+  //-------------------------------------------------------------------------------------//
+
+  enum class HeapProfileFormat
+  {
+    TEXT,   //!< Human readable estimated bytes per live sample with its call site.
+    PPROF,  //!< Legacy gperftools heap profile (`heap_v2`) loadable by `pprof`, requires backtraces to be useful.
+  };
+
+  /*!
+   * @brief
+   *   Totals over all live samples, written at the top of a heap profile.
+   */
+  struct MemoryHeapProfileTotals
+  {
+    MemoryIndex num_samples;
+    MemoryIndex num_sampled_bytes;
+  };
+
+  /*!
+   * @brief
+   *   A single sampled allocation still alive at the time of a dump.
+   */
+  struct MemorySampleView
+  {
+    const AllocationSourceInfo* source_info;
+    MemoryIndex                 size;
+    void* const*                frames;
+    MemoryIndex                 num_frames;
+  };
+
+  /*!
+   * @brief
+   *   Captures up to \p max_frames return addresses of the calling thread's stack.
+   *
+   * @return
+   *   The number of frames written, 0 on platforms without backtrace support.
+   */
+  MemoryIndex MemoryCaptureBacktrace(void** const out_frames, const MemoryIndex max_frames) noexcept;
+
+  /*!
+   * @brief
+   *   Returns a random number of bytes until the next sample, exponentially distributed with a mean of \p mean_interval.
+   */
+  std::int64_t MemorySamplingNextInterval(std::uint64_t* const rng_state, const MemoryIndex mean_interval) noexcept;
+
+  void MemoryHeapProfileWriteHeader(std::FILE* const file, const HeapProfileFormat format, const MemoryHeapProfileTotals& totals, const MemoryIndex sample_interval) noexcept;
+  void MemoryHeapProfileWriteSample(std::FILE* const file, const HeapProfileFormat format, const MemorySampleView& sample, const MemoryIndex sample_interval) noexcept;
+  void MemoryHeapProfileWriteFooter(std::FILE* const file, const HeapProfileFormat format) noexcept;
+
+  /*!
+   * @brief
+   *   Tracking policy that records roughly one allocation every `SampleInterval` bytes
+   *   using the same geometric (Poisson process) sampling as tcmalloc,
+   *   large allocations are proportionally more likely to be sampled.
+   *
+   *   Unsampled allocations only cost a subtraction and a branch,
+   *   unsampled deallocations a branch while there are no live samples and a hash lookup otherwise.
+   *
+   *   Live samples can be written out as a heap profile with `DumpHeapProfile`.
+   *
+   * @tparam MaxLiveSamples
+   *   Max number of sampled allocations alive at once, must be a power of two.
+   *   Samples taken while the table is full are dropped and counted.
+   *
+   * @tparam MaxBacktraceDepth
+   *   Number of stack frames to record per sample, 0 to disable backtraces.
+   */
+  template<MemoryIndex MaxLiveSamples = 1024u, MemoryIndex MaxBacktraceDepth = 0u>
+  class SamplingMemoryTracking
+  {
+    static_assert(MaxLiveSamples > 0u && (MaxLiveSamples & (MaxLiveSamples - 1u)) == 0u, "MaxLiveSamples must be a power of two.");
+
+   public:
+    static constexpr MemoryIndex DefaultSampleInterval = bfKilobytes(512);
+
+   private:
+    struct SampleRecord
+    {
+      const void*          ptr;  //!< nullptr for an empty slot.
+      MemoryIndex          size;
+      AllocationSourceInfo source_info;
+      MemoryIndex          num_frames;
+      void*                frames[MaxBacktraceDepth ? MaxBacktraceDepth : 1u];
+    };
+
+   private:
+    std::int64_t  m_BytesUntilSample;
+    MemoryIndex   m_SampleInterval;
+    std::uint64_t m_RngState;
+    MemoryIndex   m_NumLiveSamples;
+    std::uint64_t m_NumDroppedSamples;
+    SampleRecord  m_Samples[MaxLiveSamples];
+
+   public:
+    SamplingMemoryTracking() noexcept :
+      m_BytesUntilSample{0},
+      m_SampleInterval{DefaultSampleInterval},
+      m_RngState{reinterpret_cast<std::uintptr_t>(this) | 1u},
+      m_NumLiveSamples{0u},
+      m_NumDroppedSamples{0u},
+      m_Samples{}
+    {
+      m_BytesUntilSample = MemorySamplingNextInterval(&m_RngState, m_SampleInterval);
+    }
+
+    /*!
+     * @brief
+     *   Sets the mean number of bytes between samples, 0 disables sampling.
+     */
+    void SetSampleInterval(const MemoryIndex sample_interval) noexcept
+    {
+      m_SampleInterval   = sample_interval;
+      m_BytesUntilSample = sample_interval ? MemorySamplingNextInterval(&m_RngState, sample_interval) : INT64_MAX;
+    }
+
+    void TrackAllocate(const MemoryTrackAllocate& allocate_info) noexcept
+    {
+      m_BytesUntilSample -= std::int64_t(allocate_info.requested_bytes);
+
+      if (m_BytesUntilSample < 0)
+      {
+        RecordSample(allocate_info);
+      }
+    }
+
+    void TrackDeallocate(const MemoryTrackDeallocate& deallocate_info) noexcept
+    {
+      if (m_NumLiveSamples != 0u)
+      {
+        RemoveSample(deallocate_info.ptr);
+      }
+    }
+
+    // Query API
+
+    MemoryIndex   SampleInterval() const noexcept { return m_SampleInterval; }
+    MemoryIndex   NumLiveSamples() const noexcept { return m_NumLiveSamples; }
+    std::uint64_t NumDroppedSamples() const noexcept { return m_NumDroppedSamples; }
+
+    /*!
+     * @brief
+     *   Writes all live samples to \p file.
+     */
+    void DumpHeapProfile(std::FILE* const file, const HeapProfileFormat format = HeapProfileFormat::TEXT) const noexcept
+    {
+      MemoryHeapProfileTotals totals = {0u, 0u};
+
+      for (const SampleRecord& record : m_Samples)
+      {
+        if (record.ptr)
+        {
+          totals.num_samples += 1u;
+          totals.num_sampled_bytes += record.size;
+        }
+      }
+
+      MemoryHeapProfileWriteHeader(file, format, totals, m_SampleInterval);
+
+      for (const SampleRecord& record : m_Samples)
+      {
+        if (record.ptr)
+        {
+          const MemorySampleView sample = {&record.source_info, record.size, record.frames, record.num_frames};
+
+          MemoryHeapProfileWriteSample(file, format, sample, m_SampleInterval);
+        }
+      }
+
+      MemoryHeapProfileWriteFooter(file, format);
+    }
+
+   private:
+    static MemoryIndex SlotOf(const void* const ptr) noexcept
+    {
+      return MemoryIndex((reinterpret_cast<std::uintptr_t>(ptr) >> 4u) * 0x9E3779B97F4A7C15ull >> 16u) & (MaxLiveSamples - 1u);
+    }
+
+    void RecordSample(const MemoryTrackAllocate& allocate_info) noexcept
+    {
+      do
+      {
+        m_BytesUntilSample += MemorySamplingNextInterval(&m_RngState, m_SampleInterval);
+      } while (m_BytesUntilSample < 0);
+
+      if (m_NumLiveSamples == MaxLiveSamples)
+      {
+        ++m_NumDroppedSamples;
+        return;
+      }
+
+      MemoryIndex index = SlotOf(allocate_info.allocation.ptr);
+
+      while (m_Samples[index].ptr)
+      {
+        index = (index + 1u) & (MaxLiveSamples - 1u);
+      }
+
+      SampleRecord& record = m_Samples[index];
+
+      record.ptr         = allocate_info.allocation.ptr;
+      record.size        = allocate_info.requested_bytes;
+      record.source_info = allocate_info.source_info;
+      record.num_frames  = MaxBacktraceDepth ? MemoryCaptureBacktrace(record.frames, MaxBacktraceDepth) : 0u;
+
+      ++m_NumLiveSamples;
+    }
+
+    void RemoveSample(const void* const ptr) noexcept
+    {
+      const MemoryIndex mask  = MaxLiveSamples - 1u;
+      MemoryIndex       index = SlotOf(ptr);
+
+      while (m_Samples[index].ptr != ptr)
+      {
+        if (!m_Samples[index].ptr)
+        {
+          return;
+        }
+
+        index = (index + 1u) & mask;
+      }
+
+      // Backward shift deletion so lookups never need tombstones.
+      MemoryIndex hole = index;
+
+      for (MemoryIndex next = (hole + 1u) & mask; m_Samples[next].ptr; next = (next + 1u) & mask)
+      {
+        const MemoryIndex home = SlotOf(m_Samples[next].ptr);
+
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+          m_Samples[hole] = m_Samples[next];
+          hole            = next;
+        }
+      }
+
+      m_Samples[hole].ptr = nullptr;
+      --m_NumLiveSamples;
+    }
+  };
+
+  //-------------------------------------------------------------------------------------//
+  // Trace Tracking
+  //-------------------------------------------------------------------------------------//
+
+  static constexpr MemoryIndex   DefaultTraceRecordsPerThread = 1u << 20u;  //!< 32MiB of trace file per thread.
+  static constexpr std::uint32_t MemoryTraceFileVersion       = 1u;
+
+  enum class MemoryTraceOp : std::uint8_t
+  {
+    ALLOCATE   = 0,
+    DEALLOCATE = 1,
+  };
+
+  /*!
+   * @brief
+   *   A single traced allocator event.
+   *
+   *   The thread is not stored per record since each thread writes to its own trace file,
+   *   see `MemoryTraceFileHeader::thread_id`.
+   */
+  struct MemoryTraceRecord
+  {
+    std::uint64_t timestamp;       //!< Nanoseconds since `MemoryTraceStart`.
+    std::uint64_t address;         //!< Used to pair up an allocation with its deallocation.
+    std::uint64_t size;            //!< Bytes requested from the `BaseAllocator` including any bounds checking overhead.
+    std::uint16_t call_site;       //!< From `MemoryTraceInternCallSite`, 0 when unknown.
+    std::uint16_t allocator_id;    //!< From `MemoryTraceNewAllocatorId`, addresses are only unique within an allocator.
+    MemoryTraceOp op;              //!<
+    std::uint8_t  log2_alignment;  //!<
+    std::uint16_t reserved;        //!< Always 0.
+  };
+
+  /*!
+   * @brief
+   *   The start of each per thread trace file which is followed by `capacity` records.
+   *
+   *   The records are a ring, once `num_written` passes `capacity` only the newest
+   *   `capacity` records remain with the oldest at `num_written % capacity`.
+   */
+  struct MemoryTraceFileHeader
+  {
+    char          magic[8];     //!< "BFTRACE" with a nul terminator.
+    std::uint32_t version;      //!< `MemoryTraceFileVersion`.
+    std::uint32_t record_size;  //!< `sizeof(MemoryTraceRecord)`.
+    std::uint64_t thread_id;    //!< OS id of the thread that wrote this file.
+    std::uint64_t capacity;     //!<
+    std::uint64_t num_written;  //!< Total records written, updated after each record so a crashed process still leaves a valid trace.
+    std::uint64_t reserved[3];  //!< Pads the header to a cache line, always 0.
+  };
+
+  static_assert(sizeof(MemoryTraceRecord) == 32u, "Trace records are a fixed size on disk.");
+  static_assert(sizeof(MemoryTraceFileHeader) == 64u, "The trace file header is a fixed size on disk.");
+
+  /*!
+   * @brief
+   *   Begins a trace, each thread that then allocates from a traced allocator
+   *   maps its own `<path_prefix>.<N>.bftrace` file as a ring of \p records_per_thread records.
+   *
+   *   Since the files are memory mapped nothing needs to be flushed and a
+   *   trace survives the process crashing.
+   *
+   * @return
+   *   false if a trace is already active or \p path_prefix is too long.
+   */
+  bool MemoryTraceStart(const char* const path_prefix, const MemoryIndex records_per_thread = DefaultTraceRecordsPerThread) noexcept;
+
+  /*!
+   * @brief
+   *   Ends the current trace and writes the interned call sites to `<path_prefix>.sites`
+   *   as a line of `id<TAB>line<TAB>file<TAB>function` for each.
+   *
+   *   Threads close their trace file on their next allocation through a `TraceMemoryTracking`
+   *   allocator or when they exit.
+   */
+  void MemoryTraceStop() noexcept;
+
+  bool MemoryTraceIsActive() noexcept;
+
+  /*!
+   * @brief
+   *   Returns a new id to tag the records of one allocator with.
+   */
+  std::uint16_t MemoryTraceNewAllocatorId() noexcept;
+
+  /*!
+   * @brief
+   *   Returns a small id for \p source_info stable for the life of the process, lock free.
+   *
+   * @return
+   *   0 when `BF_MEMORY_ALLOCATION_INFO` is off or `BF_MEMORY_TRACE_MAX_CALL_SITES` call sites have already been seen.
+   */
+  std::uint16_t MemoryTraceInternCallSite(const AllocationSourceInfo& source_info) noexcept;
+
+  /*!
+   * @brief
+   *   Appends a record to the calling thread's trace file, does nothing while no trace is active.
+   */
+  void MemoryTraceWrite(const MemoryTraceOp op, const std::uint16_t allocator_id, const void* const ptr, const MemoryIndex size, const MemoryIndex alignment, const std::uint16_t call_site) noexcept;
+
+  /*!
+   * @brief
+   *   Tracking policy that writes each allocate and deallocate to the calling
+   *   thread's trace file while a trace is active (`MemoryTraceStart`).
+   *
+   *   No locks are taken and nothing is shared between threads besides interning a call site,
+   *   the trace can be replayed against other allocators with the `LibFoundation_Memory_TraceReplay` tool.
+   *
+   *   Only trace allocators that are not the parent of another traced allocator
+   *   otherwise a child's block can have the same address as the parent's live chunk.
+   */
+  class TraceMemoryTracking
+  {
+   private:
+    std::uint16_t m_AllocatorId;
+
+   public:
+    TraceMemoryTracking() noexcept :
+      m_AllocatorId{MemoryTraceNewAllocatorId()}
+    {
+    }
+
+    // `MemoryTraceWrite` is called even without an active trace so the thread can close its file from the last one.
+
+    void TrackAllocate(const MemoryTrackAllocate& allocate_info) const noexcept
+    {
+      const std::uint16_t call_site = MemoryTraceIsActive() ? MemoryTraceInternCallSite(allocate_info.source_info) : 0u;
+
+      MemoryTraceWrite(MemoryTraceOp::ALLOCATE, m_AllocatorId, allocate_info.allocation.ptr, allocate_info.requested_bytes, allocate_info.alignment, call_site);
+    }
+
+    void TrackDeallocate(const MemoryTrackDeallocate& deallocate_info) const noexcept
+    {
+      MemoryTraceWrite(MemoryTraceOp::DEALLOCATE, m_AllocatorId, deallocate_info.ptr, deallocate_info.num_bytes, deallocate_info.alignment, 0u);
+    }
+
+    // Query API
+
+    std::uint16_t AllocatorId() const noexcept { return m_AllocatorId; }
+  };
+}  // namespace Memory
+
+#endif  // LIB_FOUNDATION_MEMORY_TRACKING_POLICIES_HPP
+
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
@@ -0,0 +1,268 @@
+/******************************************************************************/
+/*!
+ * @file   virtual_memory.hpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Operating system virtual memory primitives and allocators built on
+ *   reserving address space up front and committing pages on demand.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#ifndef LIB_FOUNDATION_MEMORY_VIRTUAL_MEMORY_HPP
+#define LIB_FOUNDATION_MEMORY_VIRTUAL_MEMORY_HPP
+
+#include "basic_types.hpp"  // byte, AllocationResult, MemoryIndex
+
+namespace Memory
+{
+  //-------------------------------------------------------------------------------------//
+  // Virtual Memory Primitives
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   The granularity the OS can commit and decommit memory at.
+   */
+  MemoryIndex VirtualMemoryPageSize() noexcept;
+
+  /*!
+   * @brief
+   *   Reserves a range of address space without backing it with physical memory.
+   *
+   * @param size
+   *   The number of bytes to reserve, should be a multiple of `VirtualMemoryPageSize`.
+   *
+   * @return
+   *   The start of the reserved range, nullptr on failure.
+   */
+  void* VirtualMemoryReserve(const MemoryIndex size) noexcept;
+
+  /*!
+   * @brief
+   *   Makes a page aligned range of reserved memory readable and writable.
+   *
+   * @return
+   *   true on success, false if the OS could not commit the memory.
+   */
+  bool VirtualMemoryCommit(void* const ptr, const MemoryIndex size) noexcept;
+
+  /*!
+   * @brief
+   *   Returns the physical memory of a page aligned committed range back to
+   *   the OS while keeping the address range reserved.
+   */
+  void VirtualMemoryDecommit(void* const ptr, const MemoryIndex size) noexcept;
+
+  /*!
+   * @brief
+   *   Gives back a whole range from `VirtualMemoryReserve`.
+   *
+   * @param size
+   *   Must be the same size passed to `VirtualMemoryReserve`.
+   */
+  void VirtualMemoryRelease(void* const ptr, const MemoryIndex size) noexcept;
+
+  //-------------------------------------------------------------------------------------//
+  // Huge Pages
+  //-------------------------------------------------------------------------------------//
+
+  static constexpr MemoryIndex HugePageSize2MiB = bfMegabytes(2);
+  static constexpr MemoryIndex HugePageSize1GiB = bfGigabytes(1);
+
+  /*!
+   * @brief
+   *   How the memory from `VirtualMemoryAllocateHuge` ended up being backed.
+   */
+  enum class HugePageBacking : unsigned char
+  {
+    NONE,         //!< The allocation failed.
+    EXPLICIT,     //!< Reserved huge pages (`MAP_HUGETLB` / `MEM_LARGE_PAGES`).
+    TRANSPARENT,  //!< Normal pages aligned to the huge page size and marked with `MADV_HUGEPAGE`, the kernel may promote them.
+    NORMAL,       //!< Normal pages, huge pages are unavailable on this system.
+  };
+
+  /*!
+   * @brief
+   *   Allocates committed memory backed by huge pages to cut down on TLB misses.
+   *
+   *   Explicit huge pages are tried first which need to have been reserved with the OS
+   *   (`vm.nr_hugepages` on Linux, the "Lock pages in memory" privilege on Windows).
+   *   With \p allow_fallback a failure then falls back to transparent huge pages
+   *   and finally normal pages.
+   *
+   * @param size
+   *   The number of bytes to allocate, must be a multiple of \p huge_page_size.
+   *
+   * @param huge_page_size
+   *   `HugePageSize2MiB` or `HugePageSize1GiB`, the transparent fallback is always 2MiB pages on Linux.
+   *
+   * @param out_backing
+   *   Optional, set to how the memory was backed.
+   *
+   * @return
+   *   Memory aligned to \p huge_page_size (whenever the OS allows) to be freed with `VirtualMemoryRelease`, nullptr on failure.
+   */
+  void* VirtualMemoryAllocateHuge(const MemoryIndex size, const MemoryIndex huge_page_size, const bool allow_fallback, HugePageBacking* const out_backing = nullptr) noexcept;
+
+  //-------------------------------------------------------------------------------------//
+  // Virtual Linear Allocator
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   Same interface as `LinearAllocator` but the memory is a large reserved
+   *   address range that is only committed as `m_Current` advances.
+   *
+   *   Pointers are stable for the lifetime of the allocator and resident memory
+   *   matches the high water mark of use rather than the reserved size.
+   */
+  class VirtualLinearAllocator
+  {
+    friend class VirtualLinearAllocatorSavePoint;
+
+   public:
+    static constexpr MemoryIndex RetainAllCommitted = MemoryIndex(-1);  //!< Never decommit memory once it has been committed.
+
+   private:
+    byte*       m_MemoryBgn;
+    const byte* m_MemoryEnd;
+    byte*       m_Current;
+    byte*       m_CommitEnd;
+    MemoryIndex m_CommitGranularity;
+    MemoryIndex m_RetainedCommitSize;
+
+   public:
+    /*!
+     * @param reserve_size
+     *   The maximum number of bytes this allocator can hand out.
+     *
+     * @param retained_commit_size
+     *   How many committed bytes to keep on `Clear` or a save point restore,
+     *   any committed memory above this is decommitted.
+     */
+    VirtualLinearAllocator(const MemoryIndex reserve_size, const MemoryIndex retained_commit_size = RetainAllCommitted) noexcept;
+
+    VirtualLinearAllocator(const VirtualLinearAllocator& rhs)            = delete;
+    VirtualLinearAllocator(VirtualLinearAllocator&& rhs)                 = delete;
+    VirtualLinearAllocator& operator=(const VirtualLinearAllocator& rhs) = delete;
+    VirtualLinearAllocator& operator=(VirtualLinearAllocator&& rhs)      = delete;
+
+    MemoryIndex UsedMemory() const { return m_Current - m_MemoryBgn; }
+    MemoryIndex CommittedMemory() const { return m_CommitEnd - m_MemoryBgn; }
+    MemoryIndex TotalMemory() const { return m_MemoryEnd - m_MemoryBgn; }
+    const byte* MemoryBgn() const { return m_MemoryBgn; }
+    const byte* MemoryEnd() const { return m_MemoryEnd; }
+    bool        IsPtrInRange(const void* const ptr) const { return m_MemoryBgn <= static_cast<const byte*>(ptr) && static_cast<const byte*>(ptr) < m_MemoryEnd; }
+
+    void             Clear() noexcept;
+    bool             CanServiceAllocation(const MemoryIndex size, const MemoryIndex alignment) const noexcept;
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info */) noexcept;
+    void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept;
+    AllocationResult Resize(void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info */) noexcept;
+    void             QueryStats(AllocatorStats& out_stats) const noexcept;  // The whole reserved range is the total, committing is not counted.
+
+    ~VirtualLinearAllocator() noexcept;
+
+   private:
+    bool CommitUpTo(byte* const end) noexcept;
+    void RewindTo(byte* const restore_point) noexcept;
+  };
+
+  class VirtualLinearAllocatorSavePoint
+  {
+   private:
+    VirtualLinearAllocator* m_Allocator;     //!< The allocator to restore to.
+    byte*                   m_RestorePoint;  //!< The point in memory to go back to.
+
+   public:
+    void Save(VirtualLinearAllocator& allocator) noexcept;
+    void Restore() noexcept;
+  };
+
+  struct VirtualLinearAllocatorScope : private VirtualLinearAllocatorSavePoint
+  {
+    VirtualLinearAllocatorScope(VirtualLinearAllocator& allocator) noexcept :
+      VirtualLinearAllocatorSavePoint{}
+    {
+      Save(allocator);
+    }
+
+    VirtualLinearAllocatorScope(const VirtualLinearAllocatorScope& rhs) noexcept            = delete;
+    VirtualLinearAllocatorScope(VirtualLinearAllocatorScope&& rhs) noexcept                 = delete;
+    VirtualLinearAllocatorScope& operator=(const VirtualLinearAllocatorScope& rhs) noexcept = delete;
+    VirtualLinearAllocatorScope& operator=(VirtualLinearAllocatorScope&& rhs) noexcept      = delete;
+
+    ~VirtualLinearAllocatorScope() noexcept { Restore(); }
+  };
+
+  //-------------------------------------------------------------------------------------//
+  // Huge Page Allocator
+  //-------------------------------------------------------------------------------------//
+
+  /*!
+   * @brief
+   *   Hands out whole huge pages as the backing of a chunked allocator.
+   *
+   *   Every allocation is rounded up to the huge page size so chunk sizes should
+   *   come from `ChunkSize` (or `GrowingPoolAllocator::NumBlocksPerChunkForSize`)
+   *   to keep the chunks filling their pages.
+   *
+   *   To be used as a parent allocator it must be wrapped without bound checking
+   *   since the guard bytes would push each chunk into another huge page.
+   *
+   *   ```
+   *   Allocator<HugePageAllocator, AllocationMarkPolicy::UNMARKED, BoundCheckingPolicy::UNCHECKED> huge_pages{};
+   *   GrowingPoolAllocator pool{huge_pages, block_size, block_alignment, GrowingPoolAllocator::NumBlocksPerChunkForSize(block_size, block_alignment, HugePageSize2MiB), false, GrowingPoolAllocator::NoAutoTrim, general_heap};
+   *   ```
+   *
+   *   There is no state besides the configuration so it is safe to use from multiple threads.
+   */
+  class HugePageAllocator
+  {
+   private:
+    MemoryIndex m_HugePageSize;
+    bool        m_AllowFallback;
+
+   public:
+    /*!
+     * @param allow_fallback
+     *   When false allocations fail rather than using anything but explicit huge pages.
+     */
+    HugePageAllocator(const MemoryIndex huge_page_size = HugePageSize2MiB, const bool allow_fallback = true) noexcept;
+
+    MemoryIndex HugePageSize() const noexcept { return m_HugePageSize; }
+    MemoryIndex ChunkSize(const MemoryIndex size) const noexcept;
+
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& /* source_info */) const noexcept;
+    void             Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) const noexcept;
+  };
+}  // namespace Memory
+
+#endif  // LIB_FOUNDATION_MEMORY_VIRTUAL_MEMORY_HPP
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
@@ -25,7 +25,7 @@ void* Memory::AlignPointer(const void* const ptr, const MemoryIndex alignment) n
 
   const MemoryIndex required_alignment_mask = alignment - 1;
 
-  return reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(ptr) + required_alignment_mask & ~required_alignment_mask);
+  return reinterpret_cast<void*>((reinterpret_cast<std::uintptr_t>(ptr) + required_alignment_mask) & ~required_alignment_mask);
 }
 
 MemoryIndex Memory::PointerAlignOffset(const void* const ptr, const MemoryIndex alignment) noexcept
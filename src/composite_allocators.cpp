@@ -0,0 +1,107 @@
+/******************************************************************************/
+/*!
+ * @file   composite_allocators.cpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Adaptors for building allocator hierarchies out of the other allocators,
+ *   falling back to another allocator on failure and capping memory use with
+ *   per subsystem budgets.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#include "memory/composite_allocators.hpp"
+
+//-------------------------------------------------------------------------------------//
+// Memory Budget
+//-------------------------------------------------------------------------------------//
+
+Memory::MemoryBudget::MemoryBudget(const char* const name, const MemoryIndex limit, MemoryBudget* const parent) noexcept :
+  m_Name{name},
+  m_Parent{parent},
+  m_Limit{limit},
+  m_UsedBytes{0u},
+  m_PeakBytes{0u},
+  m_NumFailedCharges{0u}
+{
+}
+
+bool Memory::MemoryBudget::TryCharge(const MemoryIndex size) noexcept
+{
+  for (MemoryBudget* budget = this; budget; budget = budget->m_Parent)
+  {
+    if (!budget->TryChargeLocal(size))
+    {
+      for (MemoryBudget* charged = this; charged != budget; charged = charged->m_Parent)
+      {
+        charged->ReleaseLocal(size);
+      }
+
+      budget->m_NumFailedCharges.fetch_add(1u, std::memory_order_relaxed);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void Memory::MemoryBudget::Release(const MemoryIndex size) noexcept
+{
+  for (MemoryBudget* budget = this; budget; budget = budget->m_Parent)
+  {
+    budget->ReleaseLocal(size);
+  }
+}
+
+bool Memory::MemoryBudget::TryChargeLocal(const MemoryIndex size) noexcept
+{
+  const MemoryIndex new_used = m_UsedBytes.fetch_add(size, std::memory_order_relaxed) + size;
+
+  if (new_used > m_Limit.load(std::memory_order_relaxed) || new_used < size)
+  {
+    ReleaseLocal(size);
+    return false;
+  }
+
+  MemoryIndex peak = m_PeakBytes.load(std::memory_order_relaxed);
+
+  while (new_used > peak && !m_PeakBytes.compare_exchange_weak(peak, new_used, std::memory_order_relaxed))
+  {
+  }
+
+  return true;
+}
+
+void Memory::MemoryBudget::ReleaseLocal(const MemoryIndex size) noexcept
+{
+  bfMemAssert(m_UsedBytes.load(std::memory_order_relaxed) >= size, "Released more memory than was charged to the budget.");
+
+  m_UsedBytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
@@ -12,6 +12,10 @@
 
 #if !BF_MEMORY_NO_DEFAULT_HEAP
 
+#if BF_MEMORY_THREAD_CACHED_HEAP
+#include "memory/growing_mt_allocators.hpp"  // ThreadCacheAllocator
+#endif
+
 #include <new>  // align_val_t, nothrow
 
 struct CxxFreeStoreAllocator
@@ -31,17 +35,34 @@ struct CxxFreeStoreAllocator
   }
 };
 
-#if BF_MEMORY_DEBUG_HEAP
-using HeapAllocator = Allocator<CxxFreeStoreAllocator, AllocationMarkPolicy::MARKED, BoundCheckingPolicy::CHECKED, Memory::NoMemoryTracking, Memory::NoLock>;
+#if BF_MEMORY_THREAD_CACHED_HEAP
+using FreeStoreAllocator = Allocator<CxxFreeStoreAllocator, AllocationMarkPolicy::UNMARKED, BoundCheckingPolicy::UNCHECKED, Memory::NoMemoryTracking, Memory::NoLock>;
+using HeapBaseAllocator  = Memory::ThreadCacheAllocator;
 #else
-using HeapAllocator = Allocator<CxxFreeStoreAllocator, AllocationMarkPolicy::UNMARKED, BoundCheckingPolicy::UNCHECKED, Memory::NoMemoryTracking, Memory::NoLock>;
+using HeapBaseAllocator = CxxFreeStoreAllocator;
 #endif
 
-static HeapAllocator s_DefaultHeap = {};
+#if BF_MEMORY_DEBUG_HEAP
+// The compact layout keeps the guard overhead from scaling with over-aligned allocations.
+using HeapAllocator = Allocator<HeapBaseAllocator, AllocationMarkPolicy::MARKED, BoundCheckingPolicy::CHECKED_COMPACT, Memory::NoMemoryTracking, Memory::NoLock>;
+#else
+using HeapAllocator = Allocator<HeapBaseAllocator, AllocationMarkPolicy::UNMARKED, BoundCheckingPolicy::UNCHECKED, Memory::NoMemoryTracking, Memory::NoLock>;
+#endif
 
 IPolymorphicAllocator& Memory::DefaultHeap() noexcept
 {
+#if BF_MEMORY_THREAD_CACHED_HEAP
+  // The heap is intentionally never destroyed so that memory freed during static destruction is still valid.
+  static FreeStoreAllocator s_FreeStore = {};
+  alignas(HeapAllocator) static byte s_DefaultHeapStorage[sizeof(HeapAllocator)];
+  static HeapAllocator* const s_DefaultHeap = new (s_DefaultHeapStorage) HeapAllocator(s_FreeStore);
+
+  return *s_DefaultHeap;
+#else
+  static HeapAllocator s_DefaultHeap = {};
+
   return s_DefaultHeap;
+#endif
 }
 
 #endif
@@ -0,0 +1,281 @@
+/******************************************************************************/
+/*!
+ * @file   deferred_free.cpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Ways to free memory from a thread other than the one allowed to call
+ *   `Deallocate`, either by handing it back to the owning thread or by
+ *   waiting until no lock-free reader can still be using it.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#include "memory/deferred_free.hpp"
+
+//-------------------------------------------------------------------------------------//
+// Remote Free List
+//-------------------------------------------------------------------------------------//
+
+void Memory::RemoteFreeList::Push(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
+{
+  bfMemAssert(size >= MinBlockSize && IsPointerAligned(ptr, MinBlockAlignment), "Block is too small to be queued.");
+  bfMemAssert(size < (MemoryIndex(1u) << RemoteFreeBlock::AlignmentShift), "Block is too large to be queued.");
+
+  MemoryIndex alignment_shift = 0u;
+
+  while ((MemoryIndex(1u) << alignment_shift) < alignment)
+  {
+    ++alignment_shift;
+  }
+
+  RemoteFreeBlock* const block = static_cast<RemoteFreeBlock*>(ptr);
+  block->size_and_alignment    = size | (alignment_shift << RemoteFreeBlock::AlignmentShift);
+  block->next                  = m_Head.load(std::memory_order_relaxed);
+
+  while (!m_Head.compare_exchange_weak(block->next, block, std::memory_order_release, std::memory_order_relaxed))
+  {
+  }
+}
+
+//-------------------------------------------------------------------------------------//
+// Epoch Based Reclamation
+//-------------------------------------------------------------------------------------//
+
+namespace Epoch
+{
+  static constexpr std::uint64_t FirstEpoch  = 1u;  //!< 0 is reserved for a participant outside of a critical section.
+  static constexpr std::uint64_t GracePeriod = 2u;  //!< Epoch advances needed before every reader that could see a retired pointer has exited.
+
+  static bool IsReclaimable(const Memory::RetiredAllocation& retired, const std::uint64_t global_epoch) noexcept
+  {
+    return retired.epoch + GracePeriod <= global_epoch;
+  }
+
+  static void FreeRetired(const Memory::RetiredAllocation& retired) noexcept
+  {
+    if (retired.destroy)
+    {
+      retired.destroy(retired.ptr);
+    }
+
+    retired.allocator->Deallocate(retired.ptr, retired.size, retired.alignment);
+  }
+
+  // Frees every reclaimable allocation and compacts the rest to the front.
+  static MemoryIndex ReclaimList(bf::Array<Memory::RetiredAllocation>& list, const std::uint64_t global_epoch) noexcept
+  {
+    const MemoryIndex num_retired = list.size();
+    MemoryIndex       num_kept    = 0u;
+
+    for (MemoryIndex index = 0u; index < num_retired; ++index)
+    {
+      const Memory::RetiredAllocation& retired = list[index];
+
+      if (IsReclaimable(retired, global_epoch))
+      {
+        FreeRetired(retired);
+      }
+      else
+      {
+        list[num_kept++] = retired;
+      }
+    }
+
+    list.resize(num_kept);
+
+    return num_retired - num_kept;
+  }
+}  // namespace Epoch
+
+Memory::EpochDomain::EpochDomain(IPolymorphicAllocator& memory) noexcept :
+  m_GlobalEpoch{Epoch::FirstEpoch},
+  m_Lock{},
+  m_Participants{nullptr},
+  m_Orphans{memory}
+{
+}
+
+bool Memory::EpochDomain::TryAdvance() noexcept
+{
+  std::lock_guard<std::mutex> lock{m_Lock};
+
+  return TryAdvanceLocked();
+}
+
+Memory::EpochDomain::~EpochDomain() noexcept
+{
+  bfMemAssert(m_Participants == nullptr, "All participants must be destroyed before the domain.");
+
+  for (const RetiredAllocation& retired : m_Orphans)
+  {
+    Epoch::FreeRetired(retired);
+  }
+}
+
+bool Memory::EpochDomain::TryAdvanceLocked() noexcept
+{
+  const std::uint64_t global_epoch = m_GlobalEpoch.load(std::memory_order_relaxed);
+
+  // Pairs with the fence in `EpochParticipant::Enter`.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  for (const EpochParticipant* participant = m_Participants; participant; participant = participant->m_Next)
+  {
+    const std::uint64_t local_epoch = participant->m_LocalEpoch.load(std::memory_order_relaxed);
+
+    if (local_epoch != 0u && local_epoch != global_epoch)
+    {
+      return false;
+    }
+  }
+
+  m_GlobalEpoch.store(global_epoch + 1u, std::memory_order_release);
+  Epoch::ReclaimList(m_Orphans, global_epoch + 1u);
+
+  return true;
+}
+
+Memory::EpochParticipant::EpochParticipant(EpochDomain& domain, IPolymorphicAllocator& memory) noexcept :
+  m_Domain{domain},
+  m_Prev{nullptr},
+  m_Next{nullptr},
+  m_LocalEpoch{0u},
+  m_Retired{memory},
+  m_NumRetiresSinceAdvance{0u}
+{
+  std::lock_guard<std::mutex> lock{m_Domain.m_Lock};
+
+  m_Next = m_Domain.m_Participants;
+
+  if (m_Next)
+  {
+    m_Next->m_Prev = this;
+  }
+
+  m_Domain.m_Participants = this;
+}
+
+void Memory::EpochParticipant::Enter() noexcept
+{
+  bfMemAssert(!IsInCriticalSection(), "Critical sections do not nest.");
+
+  std::uint64_t global_epoch = m_Domain.m_GlobalEpoch.load(std::memory_order_relaxed);
+
+  for (;;)
+  {
+    m_LocalEpoch.store(global_epoch, std::memory_order_relaxed);
+
+    // Either `TryAdvance` sees this participant or this participant sees every unlink made before the advance.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    const std::uint64_t current_epoch = m_Domain.m_GlobalEpoch.load(std::memory_order_relaxed);
+
+    if (current_epoch == global_epoch)
+    {
+      break;
+    }
+
+    global_epoch = current_epoch;
+  }
+}
+
+void Memory::EpochParticipant::Exit() noexcept
+{
+  bfMemAssert(IsInCriticalSection(), "Exit called without a matching Enter.");
+
+  m_LocalEpoch.store(0u, std::memory_order_release);
+}
+
+MemoryIndex Memory::EpochParticipant::Reclaim() noexcept
+{
+  return Epoch::ReclaimList(m_Retired, m_Domain.GlobalEpoch());
+}
+
+Memory::EpochParticipant::~EpochParticipant() noexcept
+{
+  bfMemAssert(!IsInCriticalSection(), "Participant destroyed inside of a critical section.");
+
+  std::lock_guard<std::mutex> lock{m_Domain.m_Lock};
+
+  if (m_Prev)
+  {
+    m_Prev->m_Next = m_Next;
+  }
+  else
+  {
+    m_Domain.m_Participants = m_Next;
+  }
+
+  if (m_Next)
+  {
+    m_Next->m_Prev = m_Prev;
+  }
+
+  m_Domain.TryAdvanceLocked();
+  Epoch::ReclaimList(m_Retired, m_Domain.m_GlobalEpoch.load(std::memory_order_relaxed));
+
+  for (const RetiredAllocation& retired : m_Retired)
+  {
+    const bool was_orphaned = m_Domain.m_Orphans.push_back(retired);
+
+    bfMemAssert(was_orphaned, "Out of memory, a retired allocation was leaked.");
+    (void)was_orphaned;
+  }
+}
+
+bool Memory::EpochParticipant::RetireImpl(const RetiredAllocation& retired) noexcept
+{
+  // The caller's unlink must be visible before the epoch is read, otherwise an
+  // older epoch could be recorded and the block reclaimed a grace period early.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  RetiredAllocation entry = retired;
+  entry.epoch             = m_Domain.m_GlobalEpoch.load(std::memory_order_relaxed);
+
+  if (!m_Retired.push_back(entry))
+  {
+    m_Domain.TryAdvance();
+    Reclaim();
+
+    if (!m_Retired.push_back(entry))
+    {
+      return false;
+    }
+  }
+
+  if (++m_NumRetiresSinceAdvance >= RetiresPerAdvance)
+  {
+    m_NumRetiresSinceAdvance = 0u;
+    m_Domain.TryAdvance();
+    Reclaim();
+  }
+
+  return true;
+}
+
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
@@ -1,15 +1,157 @@
 #include "memory/fixed_mt_allocators.hpp"
 
-#include "memory/alignment.hpp"  // AlignPointer
+#include "memory/alignment.hpp"            // AlignPointer
+#include "memory/fixed_st_allocators.hpp"  // PoolAllocator, PoolAllocatorBlock
 
-Memory::ConcurrentLinearAllocator::ConcurrentLinearAllocator(byte* const memory_block, const MemoryIndex memory_block_size) noexcept :
+#include <thread>  // this_thread::yield
+
+namespace ConcurrentLinear
+{
+  using namespace Memory;
+
+  static constexpr MemoryIndex MaxThreadRegions = 4u;  //!< Number of allocators a thread can have a region in at once.
+
+  struct ThreadRegion
+  {
+    std::uint64_t allocator_id;  //!< 0 for an unused slot.
+    std::uint64_t generation;
+    byte*         current;
+    byte*         end;
+    MemoryIndex   wasted_bytes;
+  };
+
+  struct ThreadRegionTable
+  {
+    ThreadRegion regions[MaxThreadRegions];
+    MemoryIndex  next_eviction;
+  };
+
+  static std::atomic<std::uint64_t> s_NextAllocatorId = {1u};
+  static thread_local ThreadRegionTable t_Table       = {};
+
+  static ThreadRegion* FindRegion(const std::uint64_t allocator_id) noexcept
+  {
+    for (ThreadRegion& region : t_Table.regions)
+    {
+      if (region.allocator_id == allocator_id)
+      {
+        return &region;
+      }
+    }
+
+    return nullptr;
+  }
+
+  static ThreadRegion* FindOrAddRegion(const std::uint64_t allocator_id) noexcept
+  {
+    if (ThreadRegion* const region = FindRegion(allocator_id))
+    {
+      return region;
+    }
+
+    ThreadRegion* region = nullptr;
+
+    for (ThreadRegion& slot : t_Table.regions)
+    {
+      if (slot.allocator_id == 0u)
+      {
+        region = &slot;
+        break;
+      }
+    }
+
+    if (!region)
+    {
+      region                = &t_Table.regions[t_Table.next_eviction];
+      t_Table.next_eviction = (t_Table.next_eviction + 1u) % MaxThreadRegions;
+    }
+
+    *region              = {};
+    region->allocator_id = allocator_id;
+    return region;
+  }
+}  // namespace ConcurrentLinear
+
+Memory::ConcurrentLinearAllocator::ConcurrentLinearAllocator(byte* const memory_block, const MemoryIndex memory_block_size, const MemoryIndex thread_region_size) noexcept :
   m_MemoryBgn{memory_block},
   m_MemoryEnd{memory_block + memory_block_size},
+  m_ThreadRegionSize{thread_region_size},
+  m_Id{ConcurrentLinear::s_NextAllocatorId.fetch_add(1u, std::memory_order_relaxed)},
+  m_Generation{0u},
+  m_WastedBytes{0u},
   m_Current{memory_block}
 {
 }
 
+void Memory::ConcurrentLinearAllocator::Clear() noexcept
+{
+  m_Generation.fetch_add(1u, std::memory_order_relaxed);
+  m_WastedBytes.store(0u, std::memory_order_relaxed);
+  m_Current.store(m_MemoryBgn);
+}
+
+MemoryIndex Memory::ConcurrentLinearAllocator::ThreadWastedBytes() const noexcept
+{
+  const ConcurrentLinear::ThreadRegion* const region = ConcurrentLinear::FindRegion(m_Id);
+
+  return region && region->generation == m_Generation.load(std::memory_order_relaxed) ? region->wasted_bytes : 0u;
+}
+
 AllocationResult Memory::ConcurrentLinearAllocator::Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo&) noexcept
+{
+  if (m_ThreadRegionSize == 0u || size > m_ThreadRegionSize / 2u)
+  {
+    return AllocateShared(size, alignment);
+  }
+
+  ConcurrentLinear::ThreadRegion* const region     = ConcurrentLinear::FindOrAddRegion(m_Id);
+  const std::uint64_t                   generation = m_Generation.load(std::memory_order_relaxed);
+
+  if (region->generation != generation)
+  {
+    region->generation   = generation;
+    region->current      = nullptr;
+    region->end          = nullptr;
+    region->wasted_bytes = 0u;
+  }
+
+  byte* aligned_ptr = static_cast<byte*>(AlignPointer(region->current, alignment));
+
+  if (!region->current || aligned_ptr + size > region->end)
+  {
+    const MemoryIndex tail_size = region->end - region->current;
+
+    region->wasted_bytes += tail_size;
+    m_WastedBytes.fetch_add(tail_size, std::memory_order_relaxed);
+
+    byte* const region_bgn = m_Current.fetch_add(m_ThreadRegionSize);
+
+    if (region_bgn >= m_MemoryEnd)
+    {
+      // Don't want to wrap around after many failed allocations.
+      m_Current.store(m_MemoryEnd);
+      region->current = nullptr;
+      region->end     = nullptr;
+      return AllocationResult::Null();
+    }
+
+    const MemoryIndex region_size = MemoryIndex(m_MemoryEnd - region_bgn) < m_ThreadRegionSize ? MemoryIndex(m_MemoryEnd - region_bgn) : m_ThreadRegionSize;
+
+    region->current = region_bgn;
+    region->end     = region_bgn + region_size;
+    aligned_ptr     = static_cast<byte*>(AlignPointer(region_bgn, alignment));
+
+    if (aligned_ptr + size > region->end)
+    {
+      return AllocationResult::Null();
+    }
+  }
+
+  region->current = aligned_ptr + size;
+  return AllocationResult{aligned_ptr, size};
+}
+
+AllocationResult Memory::ConcurrentLinearAllocator::AllocateShared(const MemoryIndex size, const MemoryIndex alignment) noexcept
 {
   const MemoryIndex required_size   = size + (alignment - 1);
   byte* const       ptr             = m_Current.fetch_add(required_size);
@@ -34,3 +176,242 @@ void Memory::ConcurrentLinearAllocator::Deallocate(void* const /* ptr */, const
 {
   /* NO-OP */
 }
+
+//-------------------------------------------------------------------------------------//
+// Concurrent Frame Allocator
+//-------------------------------------------------------------------------------------//
+
+Memory::ConcurrentFrameAllocatorBase::ConcurrentFrameAllocatorBase(ConcurrentFrame* const frames, const MemoryIndex num_frames) noexcept :
+  m_Frames{frames},
+  m_NumFrames{num_frames},
+  m_CurrentFrame{0u}
+{
+}
+
+std::uint64_t Memory::ConcurrentFrameAllocatorBase::SubmitFrame(const std::uint32_t num_consumers) noexcept
+{
+  const ConcurrentFrame& next_frame = FrameOf(m_CurrentFrame.load(std::memory_order_relaxed) + 1u);
+
+  // Consumers take on the order of a frame to finish so this yields rather than spins.
+  while (!IsFrameFree(next_frame))
+  {
+    std::this_thread::yield();
+  }
+
+  return AdvanceFrame(num_consumers);
+}
+
+bool Memory::ConcurrentFrameAllocatorBase::TrySubmitFrame(const std::uint32_t num_consumers, std::uint64_t* const out_frame) noexcept
+{
+  if (IsFrameFree(FrameOf(m_CurrentFrame.load(std::memory_order_relaxed) + 1u)))
+  {
+    *out_frame = AdvanceFrame(num_consumers);
+    return true;
+  }
+
+  return false;
+}
+
+void Memory::ConcurrentFrameAllocatorBase::ReleaseFrame(const std::uint64_t frame) noexcept
+{
+  ConcurrentFrame& released_frame = FrameOf(frame);
+
+  bfMemAssert(released_frame.index.load(std::memory_order_acquire) == frame, "Frame %llu was already reused, it was released more times than it had consumers.", static_cast<unsigned long long>(frame));
+  bfMemAssert(released_frame.num_pending_consumers.load(std::memory_order_relaxed) != 0u, "Frame released more times than it had consumers.");
+
+  // Release so every read of the frame's memory happens before the producer's acquire in `IsFrameFree`.
+  released_frame.num_pending_consumers.fetch_sub(1u, std::memory_order_release);
+}
+
+bool Memory::ConcurrentFrameAllocatorBase::IsFrameReleased(const std::uint64_t frame) const noexcept
+{
+  const ConcurrentFrame& queried_frame = FrameOf(frame);
+
+  return queried_frame.index.load(std::memory_order_acquire) != frame || IsFrameFree(queried_frame);
+}
+
+AllocationResult Memory::ConcurrentFrameAllocatorBase::Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+{
+  for (;;)
+  {
+    const std::uint64_t frame_number = CurrentFrame();
+    ConcurrentFrame&    frame        = FrameOf(frame_number);
+
+    // Pinning then checking the frame is still current pairs with `AdvanceFrame` publishing
+    // then waiting on `num_writers`, so either the submit waits for this allocation or it is retried.
+    frame.num_writers.fetch_add(1u, std::memory_order_seq_cst);
+
+    if (m_CurrentFrame.load(std::memory_order_seq_cst) == frame_number)
+    {
+      const AllocationResult result = frame.allocator.Allocate(size, alignment, source_info);
+
+      frame.num_writers.fetch_sub(1u, std::memory_order_release);
+      return result;
+    }
+
+    frame.num_writers.fetch_sub(1u, std::memory_order_relaxed);
+  }
+}
+
+void Memory::ConcurrentFrameAllocatorBase::Deallocate(void* const /* ptr */, const MemoryIndex /* size */, const MemoryIndex /* alignment */) noexcept
+{
+  /* NO-OP */
+}
+
+std::uint64_t Memory::ConcurrentFrameAllocatorBase::AdvanceFrame(const std::uint32_t num_consumers) noexcept
+{
+  const std::uint64_t submitted_frame  = m_CurrentFrame.load(std::memory_order_relaxed);
+  const std::uint64_t next_frame       = submitted_frame + 1u;
+  ConcurrentFrame&    submitted_buffer = FrameOf(submitted_frame);
+  ConcurrentFrame&    next_buffer      = FrameOf(next_frame);
+
+  submitted_buffer.num_pending_consumers.store(num_consumers, std::memory_order_relaxed);
+
+  // The next buffer's last frame had its writers drained when it was submitted and any producer
+  // still holding that old frame number fails the check in `Allocate`, so it is safe to clear.
+  next_buffer.allocator.Clear();
+  next_buffer.index.store(next_frame, std::memory_order_release);
+
+  m_CurrentFrame.store(next_frame, std::memory_order_seq_cst);
+
+  // Producers that pinned the submitted frame before the new one was published finish their bump,
+  // the acquire makes their writes visible to whoever the frame is handed to.
+  while (submitted_buffer.num_writers.load(std::memory_order_seq_cst) != 0u)
+  {
+    std::this_thread::yield();
+  }
+
+  return submitted_frame;
+}
+
+//-------------------------------------------------------------------------------------//
+// Concurrent Pool Allocator
+//-------------------------------------------------------------------------------------//
+
+namespace ConcurrentPool
+{
+  using namespace Memory;
+
+  //
+  // 64bit platforms only use the lower 48 bits of a user space address
+  // so the upper 16 bits are free for the tag, 32bit platforms get a full 32bit tag.
+  //
+
+  static constexpr unsigned int  TagShift   = sizeof(void*) == 8u ? 48u : 32u;
+  static constexpr std::uint64_t PointerMask = (std::uint64_t(1u) << TagShift) - 1u;
+
+  static PoolAllocatorBlock* UnpackPointer(const std::uint64_t packed) noexcept
+  {
+    return reinterpret_cast<PoolAllocatorBlock*>(static_cast<std::uintptr_t>(packed & PointerMask));
+  }
+
+  static std::uint64_t Pack(const PoolAllocatorBlock* const ptr, const std::uint64_t old_packed) noexcept
+  {
+    const std::uint64_t address = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(ptr));
+
+    return (address & PointerMask) | (((old_packed >> TagShift) + 1u) << TagShift);
+  }
+}  // namespace ConcurrentPool
+
+void Memory::ConcurrentPoolFreelist::Reset(PoolAllocatorBlock* const head) noexcept
+{
+  m_Head.store(ConcurrentPool::Pack(head, m_Head.load(std::memory_order_relaxed)), std::memory_order_release);
+}
+
+void Memory::ConcurrentPoolFreelist::PushList(PoolAllocatorBlock* const head, PoolAllocatorBlock* const tail) noexcept
+{
+  bfMemAssert((reinterpret_cast<std::uintptr_t>(head) & ~ConcurrentPool::PointerMask) == 0u, "Pointer does not fit into a tagged pointer.");
+
+  std::uint64_t old_head = m_Head.load(std::memory_order_relaxed);
+
+  do
+  {
+    tail->next = ConcurrentPool::UnpackPointer(old_head);
+  } while (!m_Head.compare_exchange_weak(old_head, ConcurrentPool::Pack(head, old_head), std::memory_order_release, std::memory_order_relaxed));
+}
+
+Memory::PoolAllocatorBlock* Memory::ConcurrentPoolFreelist::Pop() noexcept
+{
+  std::uint64_t       old_head = m_Head.load(std::memory_order_acquire);
+  PoolAllocatorBlock* block;
+
+  do
+  {
+    block = ConcurrentPool::UnpackPointer(old_head);
+
+    if (!block)
+    {
+      return nullptr;
+    }
+
+    // `block` may be popped and reused by another thread before this read,
+    // the tag makes the exchange fail in that case so the stale `next` is never published.
+  } while (!m_Head.compare_exchange_weak(old_head, ConcurrentPool::Pack(block->next, old_head), std::memory_order_acquire, std::memory_order_acquire));
+
+  return block;
+}
+
+Memory::ConcurrentPoolAllocator::ConcurrentPoolAllocator(byte* const memory_block, const MemoryIndex memory_size, const MemoryIndex block_size, const MemoryIndex alignment) noexcept :
+  m_MemoryBgn{static_cast<byte*>(AlignPointer(memory_block, alignment))},
+  m_MemoryEnd{memory_block + memory_size},
+  m_BlockSize{AlignSize(block_size < sizeof(PoolAllocatorBlock) ? sizeof(PoolAllocatorBlock) : block_size, alignment)},
+  m_Alignment{alignment},
+  m_NumElements{m_MemoryBgn < m_MemoryEnd ? MemoryIndex(m_MemoryEnd - m_MemoryBgn) / m_BlockSize : 0u},
+  m_Freelist{},
+  m_NumBumped{0u}
+{
+}
+
+void Memory::ConcurrentPoolAllocator::Reset() noexcept
+{
+  m_Freelist.Reset(nullptr);
+  m_NumBumped.store(0u, std::memory_order_relaxed);
+}
+
+AllocationResult Memory::ConcurrentPoolAllocator::Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo&) noexcept
+{
+  bfMemAssert(size <= m_BlockSize, "This Allocator is made for Objects of a certain size!");
+  bfMemAssert(alignment <= m_Alignment, "This Allocator is made for Objects of a certain alignment!");
+
+  PoolAllocatorBlock* const block = m_Freelist.Pop();
+
+  if (block != nullptr)
+  {
+    return AllocationResult{block, m_BlockSize};
+  }
+
+  // The load keeps a drained pool from incrementing the index forever.
+  if (m_NumBumped.load(std::memory_order_relaxed) < m_NumElements)
+  {
+    const MemoryIndex block_index = m_NumBumped.fetch_add(1u, std::memory_order_relaxed);
+
+    if (block_index < m_NumElements)
+    {
+      return AllocationResult{m_MemoryBgn + m_BlockSize * block_index, m_BlockSize};
+    }
+  }
+
+  return AllocationResult::Null();
+}
+
+void Memory::ConcurrentPoolAllocator::Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
+{
+  bfMemAssert(size <= m_BlockSize, "That allocation did not come from this allocator (bad size).");
+  bfMemAssert(alignment <= m_Alignment, "That allocation did not come from this allocator (bad alignment).");
+  bfMemAssert(m_MemoryBgn <= ptr && ptr < m_MemoryEnd, "That allocation did not come from this allocator.");
+
+  m_Freelist.Push(static_cast<PoolAllocatorBlock*>(ptr));
+}
+
+void Memory::ConcurrentPoolAllocator::DeallocateBatch(void* const* const ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment) noexcept
+{
+  bfMemAssert(size <= m_BlockSize, "That allocation did not come from this allocator (bad size).");
+  bfMemAssert(alignment <= m_Alignment, "That allocation did not come from this allocator (bad alignment).");
+
+  const PoolAllocatorSetupResult list = PoolAllocator::LinkBlocks(ptrs, num_ptrs);
+
+  if (list.head)
+  {
+    m_Freelist.PushList(list.head, list.tail);
+  }
+}
@@ -56,6 +56,42 @@ void Memory::LinearAllocator::Deallocate(void* const ptr, const MemoryIndex size
   }
 }
 
+AllocationResult Memory::LinearAllocator::Resize(void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo&) noexcept
+{
+  (void)alignment;
+
+  byte* const block_bgn = static_cast<byte*>(ptr);
+  byte* const block_end = block_bgn + new_size;
+
+  if (block_bgn + old_size == m_Current)
+  {
+    if (block_end <= m_MemoryEnd)
+    {
+      m_Current = block_end;
+      return AllocationResult(ptr, new_size);
+    }
+  }
+  else if (new_size <= old_size)
+  {
+    // Not the top so the tail is wasted until a `Clear`.
+    return AllocationResult(ptr, new_size);
+  }
+
+  return AllocationResult::Null();
+}
+
+void Memory::LinearAllocator::QueryStats(AllocatorStats& out_stats) const noexcept
+{
+  const byte* const aligned_current = static_cast<const byte*>(AlignPointer(m_Current, DefaultAlignment));
+
+  out_stats.total_bytes        = TotalMemory();
+  out_stats.used_bytes         = UsedMemory();
+  out_stats.free_bytes         = m_MemoryEnd - m_Current;
+  out_stats.overhead_bytes     = 0u;
+  out_stats.largest_free_block = aligned_current < m_MemoryEnd ? MemoryIndex(m_MemoryEnd - aligned_current) : 0u;
+  out_stats.num_free_blocks    = out_stats.free_bytes != 0u ? 1u : 0u;
+}
+
 void Memory::LinearAllocatorSavePoint::Save(LinearAllocator& allocator) noexcept
 {
   m_Allocator    = &allocator;
@@ -101,6 +137,7 @@ namespace Stack
 }  // namespace Stack
 
 Memory::StackAllocator::StackAllocator(byte* const memory_block, MemoryIndex memory_block_size) noexcept :
+  m_MemoryBgn{memory_block},
   m_StackPtr{memory_block},
   m_MemoryEnd{memory_block + memory_block_size}
 {
@@ -135,27 +172,68 @@ void Memory::StackAllocator::Deallocate(void* const ptr, const MemoryIndex size,
   m_StackPtr = header.restore;
 }
 
+AllocationResult Memory::StackAllocator::Resize(void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo&) noexcept
+{
+  (void)alignment;
+
+  byte* const          header_ptr = static_cast<byte*>(ptr) - sizeof(StackAllocatorHeader);
+  StackAllocatorHeader header     = Stack::ReadHeader(header_ptr);
+
+  bfMemAssert(header.num_bytes == old_size, "Incorrect number of bytes passed in.");
+
+  byte* const block_end = static_cast<byte*>(ptr) + new_size;
+  const bool  is_top    = static_cast<byte*>(ptr) + old_size == m_StackPtr;
+
+  if ((is_top && block_end <= m_MemoryEnd) || new_size <= old_size)
+  {
+    if (is_top)
+    {
+      m_StackPtr = block_end;
+    }
+
+    header.num_bytes = new_size;
+    Stack::WriteHeader(header_ptr, header);
+
+    return AllocationResult{ptr, new_size};
+  }
+
+  return AllocationResult::Null();
+}
+
+void Memory::StackAllocator::QueryStats(AllocatorStats& out_stats) const noexcept
+{
+  const byte* const first_aligned = static_cast<const byte*>(AlignPointer(m_StackPtr + sizeof(StackAllocatorHeader), DefaultAlignment));
+
+  out_stats.total_bytes        = m_MemoryEnd - m_MemoryBgn;
+  out_stats.used_bytes         = m_StackPtr - m_MemoryBgn;
+  out_stats.free_bytes         = m_MemoryEnd - m_StackPtr;
+  out_stats.overhead_bytes     = 0u;
+  out_stats.largest_free_block = first_aligned < m_MemoryEnd ? MemoryIndex(m_MemoryEnd - first_aligned) : 0u;
+  out_stats.num_free_blocks    = out_stats.free_bytes != 0u ? 1u : 0u;
+}
+
 //-------------------------------------------------------------------------------------//
 // Pool Allocator
 //-------------------------------------------------------------------------------------//
 
 Memory::PoolAllocator::PoolAllocator(byte* const memory_block, const MemoryIndex memory_size, const MemoryIndex block_size, const MemoryIndex alignment) noexcept :
-  m_MemoryBgn{memory_block},
+  m_MemoryBgn{static_cast<byte*>(AlignPointer(memory_block, alignment))},
   m_MemoryEnd{memory_block + memory_size},
-  m_BlockSize{block_size},
+  m_BlockSize{AlignSize(block_size, alignment)},
   m_Alignment{alignment},
   m_PoolHead{nullptr},
-  m_NumElements{0u}
+  m_BumpCurrent{nullptr},
+  m_NumElements{m_MemoryBgn < m_MemoryEnd ? MemoryIndex(m_MemoryEnd - m_MemoryBgn) / m_BlockSize : 0u}
 {
+  bfMemAssert(block_size >= sizeof(PoolAllocatorBlock), "Each block must be at least PoolAllocatorBlock in size.");
+
   Reset();
 }
 
 void Memory::PoolAllocator::Reset() noexcept
 {
-  const PoolAllocatorSetupResult setup = SetupPool(m_MemoryBgn, m_MemoryEnd - m_MemoryBgn, m_BlockSize, m_Alignment);
-
-  m_PoolHead    = setup.head;
-  m_NumElements = setup.num_elements;
+  m_PoolHead    = nullptr;
+  m_BumpCurrent = m_MemoryBgn;
 }
 
 MemoryIndex Memory::PoolAllocator::IndexOf(const void* ptr) const noexcept
@@ -185,6 +263,15 @@ AllocationResult Memory::PoolAllocator::Allocate(const MemoryIndex size, const M
     return AllocationResult{block, m_BlockSize};
   }
 
+  if (HasUntouchedBlock())
+  {
+    byte* const untouched_block = m_BumpCurrent;
+
+    m_BumpCurrent += m_BlockSize;
+
+    return AllocationResult{untouched_block, m_BlockSize};
+  }
+
   return AllocationResult::Null();
 }
 
@@ -201,6 +288,100 @@ void Memory::PoolAllocator::Deallocate(void* const ptr, const MemoryIndex size,
   m_PoolHead  = block;
 }
 
+MemoryIndex Memory::PoolAllocator::AllocateBatch(void** const out_ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo&) noexcept
+{
+  bfMemAssert(size <= m_BlockSize, "This Allocator is made for Objects of a certain size!");
+  bfMemAssert(alignment <= m_Alignment, "This Allocator is made for Objects of a certain alignment!");
+
+  MemoryIndex num_allocated = PopBlocks(&m_PoolHead, out_ptrs, num_ptrs);
+
+  while (num_allocated < num_ptrs && HasUntouchedBlock())
+  {
+    out_ptrs[num_allocated++] = m_BumpCurrent;
+    m_BumpCurrent += m_BlockSize;
+  }
+
+  return num_allocated;
+}
+
+void Memory::PoolAllocator::DeallocateBatch(void* const* const ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment) noexcept
+{
+  bfMemAssert(size <= m_BlockSize, "That allocation did not come from this allocator (bad size).");
+  bfMemAssert(alignment <= m_Alignment, "That allocation did not come from this allocator (bad alignment).");
+
+#if BF_MEMORY_ASSERTIONS
+  for (MemoryIndex index = 0u; index < num_ptrs; ++index)
+  {
+    bfMemAssert(m_MemoryBgn <= ptrs[index] && ptrs[index] < m_MemoryEnd, "That allocation did not come from this allocator.");
+  }
+#endif
+
+  PushBlocks(&m_PoolHead, ptrs, num_ptrs);
+}
+
+void Memory::PoolAllocator::QueryStats(AllocatorStats& out_stats) const noexcept
+{
+  const byte* const blocks_end = m_MemoryBgn + m_NumElements * m_BlockSize;
+  MemoryIndex       num_free   = MemoryIndex(blocks_end - m_BumpCurrent) / m_BlockSize;
+
+  for (const PoolAllocatorBlock* block = m_PoolHead; block; block = block->next)
+  {
+    ++num_free;
+  }
+
+  out_stats.total_bytes        = m_MemoryBgn < m_MemoryEnd ? MemoryIndex(m_MemoryEnd - m_MemoryBgn) : 0u;
+  out_stats.used_bytes         = (m_NumElements - num_free) * m_BlockSize;
+  out_stats.free_bytes         = num_free * m_BlockSize;
+  out_stats.overhead_bytes     = out_stats.total_bytes - m_NumElements * m_BlockSize;
+  out_stats.largest_free_block = num_free != 0u ? m_BlockSize : 0u;
+  out_stats.num_free_blocks    = num_free;
+}
+
+Memory::PoolAllocatorSetupResult Memory::PoolAllocator::LinkBlocks(void* const* const ptrs, const MemoryIndex num_ptrs) noexcept
+{
+  if (num_ptrs != 0u)
+  {
+    const MemoryIndex last_index = num_ptrs - 1u;
+
+    for (MemoryIndex index = 0u; index < last_index; ++index)
+    {
+      static_cast<PoolAllocatorBlock*>(ptrs[index])->next = static_cast<PoolAllocatorBlock*>(ptrs[index + 1u]);
+    }
+    static_cast<PoolAllocatorBlock*>(ptrs[last_index])->next = nullptr;
+
+    return {static_cast<PoolAllocatorBlock*>(ptrs[0u]), static_cast<PoolAllocatorBlock*>(ptrs[last_index]), num_ptrs};
+  }
+
+  return {nullptr, nullptr, 0u};
+}
+
+MemoryIndex Memory::PoolAllocator::PopBlocks(PoolAllocatorBlock** const head, void** const out_ptrs, const MemoryIndex num_ptrs) noexcept
+{
+  PoolAllocatorBlock* block      = *head;
+  MemoryIndex         num_popped = 0u;
+
+  while (block && num_popped < num_ptrs)
+  {
+    out_ptrs[num_popped++] = block;
+    block                  = block->next;
+  }
+
+  *head = block;
+
+  return num_popped;
+}
+
+void Memory::PoolAllocator::PushBlocks(PoolAllocatorBlock** const head, void* const* const ptrs, const MemoryIndex num_ptrs) noexcept
+{
+  const PoolAllocatorSetupResult list = LinkBlocks(ptrs, num_ptrs);
+
+  if (list.head)
+  {
+    list.tail->next = *head;
+    *head           = list.head;
+  }
+}
+
 Memory::PoolAllocatorSetupResult Memory::PoolAllocator::SetupPool(byte* const memory_block, const MemoryIndex memory_size, const MemoryIndex block_size, const MemoryIndex alignment) noexcept
 {
   bfMemAssert(block_size >= sizeof(PoolAllocatorBlock), "Each block must be at least PoolAllocatorBlock in size.");
@@ -277,11 +458,13 @@ AllocationResult Memory::FreeListAllocator::Allocate(const MemoryIndex size, con
 
 void Memory::FreeListAllocator::Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
 {
+  (void)alignment;
+
   const AlignmentHeader offset           = FreeList::AlignedAllocationOffset(ptr);
-  const std::size_t     allocation_size  = FreeList::AlignedAllocationSize(size, alignment);
   void* const           allocation_start = reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(ptr) - offset);
 
-  DeallocateInternal(allocation_start, allocation_size);
+  // `size` can be anything up to what `Allocate` reported so measure from the real offset rather than the worst case padding.
+  DeallocateInternal(allocation_start, offset + size);
 }
 
 struct AllocationHeader
@@ -301,8 +484,29 @@ struct Memory::FreeListNode : public AllocationHeader
   unsigned char* end() const { return begin() + sizeof(AllocationHeader) + size; }
 };
 
-AllocationResult Memory::FreeListAllocator::AllocateInternal(const MemoryIndex size) noexcept
+Memory::FreeListAllocator::FreeListAllocator(byte* const memory_block, MemoryIndex memory_block_size) :
+  m_Freelist{nullptr},
+  m_MemoryBgn{nullptr},
+  m_MemoryEnd{nullptr}
 {
+  byte* const       node_start     = static_cast<byte*>(AlignPointer(memory_block, alignof(FreeListNode)));
+  const MemoryIndex alignment_loss = node_start - memory_block;
+
+  if (memory_block_size >= alignment_loss + sizeof(FreeListNode))
+  {
+    m_Freelist       = reinterpret_cast<FreeListNode*>(node_start);
+    m_Freelist->size = memory_block_size - alignment_loss - sizeof(AllocationHeader);
+    m_Freelist->next = nullptr;
+    m_MemoryBgn      = node_start;
+    m_MemoryEnd      = m_Freelist->end();
+  }
+}
+
+AllocationResult Memory::FreeListAllocator::AllocateInternal(const MemoryIndex requested_size) noexcept
+{
+  // Keeps every node that gets split off suitably aligned.
+  const MemoryIndex size = AlignSize(requested_size, alignof(FreeListNode));
+
   FreeListNode* prev_node = nullptr;
   FreeListNode* curr_node = m_Freelist;
 
@@ -325,7 +529,7 @@ AllocationResult Memory::FreeListAllocator::AllocateInternal(const MemoryIndex s
       const std::size_t   offset_from_block = sizeof(AllocationHeader) + size;
       FreeListNode* const new_node          = reinterpret_cast<FreeListNode*>(reinterpret_cast<char*>(curr_node) + offset_from_block);
 
-      new_node->size = block_size - offset_from_block - sizeof(AllocationHeader);
+      new_node->size = block_size - offset_from_block;
       new_node->next = block_next;
 
       curr_node->size = size;
@@ -381,7 +585,18 @@ void Memory::FreeListAllocator::DeallocateInternal(void* const ptr, const Memory
   //
   if (current && current->begin() == node_end)
   {
-    if (previous)
+    node->size += (current->size + sizeof(AllocationHeader));
+    node->next = current->next;
+
+    //
+    // Merge Prev => Node, filled a hole between two free blocks.
+    //
+    if (previous && previous->end() == node_begin)
+    {
+      previous->size += (node->size + sizeof(AllocationHeader));
+      previous->next = node->next;
+    }
+    else if (previous)
     {
       previous->next = node;
     }
@@ -389,9 +604,6 @@ void Memory::FreeListAllocator::DeallocateInternal(void* const ptr, const Memory
     {
       m_Freelist = node;
     }
-
-    node->size += (current->size + sizeof(AllocationHeader));
-    node->next = current->next;
   }
   else if (previous)
   {
@@ -414,3 +626,506 @@ void Memory::FreeListAllocator::DeallocateInternal(void* const ptr, const Memory
     m_Freelist = node;
   }
 }
+
+AllocationResult Memory::FreeListAllocator::Resize(void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo&) noexcept
+{
+  (void)old_size;
+
+  const AlignmentHeader   offset           = FreeList::AlignedAllocationOffset(ptr);
+  byte* const             allocation_start = static_cast<byte*>(ptr) - offset;
+  AllocationHeader* const header           = reinterpret_cast<AllocationHeader*>(allocation_start - sizeof(AllocationHeader));
+  const MemoryIndex       required_size    = AlignSize(FreeList::AlignedAllocationSize(new_size, alignment), alignof(FreeListNode));
+
+  bfMemAssert(offset + old_size <= header->size, "Invalid number of bytes passed in.");
+
+  if (required_size > header->size)
+  {
+    // Grow into the free block directly after this one, the freelist is sorted by address.
+    byte* const   block_end = allocation_start + header->size;
+    FreeListNode* prev_node = nullptr;
+    FreeListNode* curr_node = m_Freelist;
+
+    while (curr_node && curr_node->begin() < block_end)
+    {
+      prev_node = curr_node;
+      curr_node = curr_node->next;
+    }
+
+    if (!curr_node || curr_node->begin() != block_end)
+    {
+      return AllocationResult::Null();
+    }
+
+    const MemoryIndex combined_size = header->size + sizeof(AllocationHeader) + curr_node->size;
+
+    if (combined_size < required_size)
+    {
+      return AllocationResult::Null();
+    }
+
+    FreeListNode* block_next = curr_node->next;
+
+    if (combined_size - required_size > sizeof(FreeListNode))
+    {
+      FreeListNode* const new_node = reinterpret_cast<FreeListNode*>(allocation_start + required_size);
+
+      new_node->size = combined_size - required_size - sizeof(AllocationHeader);
+      new_node->next = block_next;
+
+      header->size = required_size;
+      block_next   = new_node;
+    }
+    else
+    {
+      header->size = combined_size;
+    }
+
+    if (prev_node)
+    {
+      prev_node->next = block_next;
+    }
+    else
+    {
+      m_Freelist = block_next;
+    }
+  }
+  else if (header->size - required_size > sizeof(FreeListNode))
+  {
+    // Give the tail back to the freelist.
+    byte* const       tail_bgn  = allocation_start + required_size + sizeof(AllocationHeader);
+    const MemoryIndex tail_size = header->size - required_size - sizeof(AllocationHeader);
+
+    header->size                                                                    = required_size;
+    reinterpret_cast<AllocationHeader*>(tail_bgn - sizeof(AllocationHeader))->size = tail_size;
+
+    DeallocateInternal(tail_bgn, tail_size);
+  }
+
+  return AllocationResult{ptr, header->size - offset};
+}
+
+void Memory::FreeListAllocator::QueryStats(AllocatorStats& out_stats) const noexcept
+{
+  // The blocks tile the memory and the freelist is sorted by address so both can be walked together.
+  const FreeListNode* next_free = m_Freelist;
+
+  out_stats = {};
+
+  for (const byte* block = m_MemoryBgn; block < m_MemoryEnd;)
+  {
+    const MemoryIndex block_size = reinterpret_cast<const AllocationHeader*>(block)->size;
+
+    if (block == reinterpret_cast<const byte*>(next_free))
+    {
+      // `Allocate` pads for the alignment header and worst case alignment then rounds up to the node alignment.
+      const MemoryIndex usable_size = block_size & ~(alignof(FreeListNode) - 1u);
+      const MemoryIndex padding     = sizeof(AlignmentHeader) + DefaultAlignment - 1u;
+      const MemoryIndex largest     = usable_size > padding ? usable_size - padding : 0u;
+
+      out_stats.free_bytes += block_size;
+      out_stats.num_free_blocks += 1u;
+      out_stats.largest_free_block = largest > out_stats.largest_free_block ? largest : out_stats.largest_free_block;
+
+      next_free = next_free->next;
+    }
+    else
+    {
+      out_stats.used_bytes += block_size;
+    }
+
+    out_stats.overhead_bytes += sizeof(AllocationHeader);
+    block += sizeof(AllocationHeader) + block_size;
+  }
+
+  out_stats.total_bytes = m_MemoryEnd - m_MemoryBgn;
+}
+
+//-------------------------------------------------------------------------------------//
+// TLSF Allocator
+//-------------------------------------------------------------------------------------//
+
+#include <new>  // placement new
+
+#if defined(_MSC_VER)
+#include <intrin.h>  // _BitScanForward, _BitScanReverse64
+#endif
+
+namespace TLSF
+{
+  static constexpr unsigned    SLIndexCountLog2 = 5u;                          //!< Log2 of the number of second level subdivisions.
+  static constexpr unsigned    AlignSizeLog2    = 4u;                          //!< All block sizes are a multiple of this.
+  static constexpr unsigned    FLIndexMax       = 40u;                         //!< Largest block is (1 << FLIndexMax) bytes.
+  static constexpr unsigned    SLIndexCount     = 1u << SLIndexCountLog2;
+  static constexpr unsigned    FLIndexShift     = SLIndexCountLog2 + AlignSizeLog2;
+  static constexpr unsigned    FLIndexCount     = FLIndexMax - FLIndexShift + 1u;
+  static constexpr MemoryIndex BlockAlignment   = MemoryIndex(1u) << AlignSizeLog2;
+  static constexpr MemoryIndex SmallBlockSize   = MemoryIndex(1u) << FLIndexShift;  //!< Blocks smaller than this are binned linearly.
+  static constexpr MemoryIndex FreeBit          = 0x1u;
+  static constexpr MemoryIndex SizeMask         = ~(BlockAlignment - 1u);
+
+  static_assert(FLIndexCount <= 32u, "First level bitmap is 32 bits.");
+  static_assert(SLIndexCount <= 32u, "Second level bitmap is 32 bits.");
+
+  static unsigned BitScanForward(const std::uint32_t mask)
+  {
+    bfMemAssert(mask != 0u, "Bit scan of an empty mask is undefined.");
+
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return unsigned(index);
+#else
+    return unsigned(__builtin_ctz(mask));
+#endif
+  }
+
+  static unsigned BitScanReverse(const MemoryIndex value)
+  {
+    bfMemAssert(value != 0u, "Bit scan of an empty mask is undefined.");
+
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return unsigned(index);
+#else
+    return unsigned(sizeof(unsigned long long) * 8u - 1u) - unsigned(__builtin_clzll(value));
+#endif
+  }
+}  // namespace TLSF
+
+/*!
+ * @brief
+ *   Every block (free or used) is prefixed with this header, the free list
+ *   links are only valid while the block is free and overlap the user data.
+ */
+struct TLSFBlockHeader
+{
+  TLSFBlockHeader* prev_physical;   //!< The block right before this one in memory, nullptr for the first block.
+  MemoryIndex      size_and_flags;  //!< Size of the user region, the low bits store `TLSF::FreeBit`.
+  TLSFBlockHeader* next_free;
+  TLSFBlockHeader* prev_free;
+
+  static constexpr MemoryIndex OverheadSize = sizeof(prev_physical) + sizeof(size_and_flags);
+  static constexpr MemoryIndex MinSize      = sizeof(next_free) + sizeof(prev_free);
+
+  MemoryIndex      Size() const { return size_and_flags & TLSF::SizeMask; }
+  bool             IsFree() const { return (size_and_flags & TLSF::FreeBit) != 0u; }
+  void             SetSize(const MemoryIndex size) { size_and_flags = size | (size_and_flags & TLSF::FreeBit); }
+  void             SetFree(const bool is_free) { size_and_flags = is_free ? (size_and_flags | TLSF::FreeBit) : (size_and_flags & ~TLSF::FreeBit); }
+  byte*            Data() { return reinterpret_cast<byte*>(this) + OverheadSize; }
+  TLSFBlockHeader* NextPhysical() { return reinterpret_cast<TLSFBlockHeader*>(Data() + Size()); }
+
+  static TLSFBlockHeader* FromData(void* const ptr) { return reinterpret_cast<TLSFBlockHeader*>(static_cast<byte*>(ptr) - OverheadSize); }
+};
+
+static_assert(TLSFBlockHeader::OverheadSize % TLSF::BlockAlignment == 0u, "Block user data must stay aligned.");
+static_assert(TLSFBlockHeader::MinSize % TLSF::BlockAlignment == 0u, "Min block size must stay aligned.");
+
+struct Memory::TLSFControl
+{
+  std::uint32_t    fl_bitmap;
+  std::uint32_t    sl_bitmap[TLSF::FLIndexCount];
+  TLSFBlockHeader* blocks[TLSF::FLIndexCount][TLSF::SLIndexCount];
+
+  static void MappingInsert(const MemoryIndex size, unsigned* const out_fl, unsigned* const out_sl) noexcept
+  {
+    if (size < TLSF::SmallBlockSize)
+    {
+      *out_fl = 0u;
+      *out_sl = unsigned(size / (TLSF::SmallBlockSize / TLSF::SLIndexCount));
+    }
+    else
+    {
+      const unsigned fl = TLSF::BitScanReverse(size);
+
+      *out_sl = unsigned(size >> (fl - TLSF::SLIndexCountLog2)) ^ TLSF::SLIndexCount;
+      *out_fl = fl - (TLSF::FLIndexShift - 1u);
+    }
+  }
+
+  // Rounds up so that any block in the found list is large enough.
+  static void MappingSearch(MemoryIndex size, unsigned* const out_fl, unsigned* const out_sl) noexcept
+  {
+    if (size >= TLSF::SmallBlockSize)
+    {
+      size += (MemoryIndex(1u) << (TLSF::BitScanReverse(size) - TLSF::SLIndexCountLog2)) - 1u;
+    }
+
+    MappingInsert(size, out_fl, out_sl);
+  }
+
+  TLSFBlockHeader* FindSuitableBlock(unsigned* const in_out_fl, unsigned* const in_out_sl) const noexcept
+  {
+    unsigned fl = *in_out_fl;
+
+    if (fl >= TLSF::FLIndexCount)
+    {
+      return nullptr;
+    }
+
+    std::uint32_t sl_map = sl_bitmap[fl] & (~std::uint32_t(0u) << *in_out_sl);
+
+    if (!sl_map)
+    {
+      const std::uint32_t fl_map = (fl + 1u) < 32u ? fl_bitmap & (~std::uint32_t(0u) << (fl + 1u)) : 0u;
+
+      if (!fl_map)
+      {
+        return nullptr;
+      }
+
+      fl     = TLSF::BitScanForward(fl_map);
+      sl_map = sl_bitmap[fl];
+    }
+
+    const unsigned sl = TLSF::BitScanForward(sl_map);
+
+    *in_out_fl = fl;
+    *in_out_sl = sl;
+
+    return blocks[fl][sl];
+  }
+
+  void InsertFreeBlock(TLSFBlockHeader* const block) noexcept
+  {
+    unsigned fl, sl;
+    MappingInsert(block->Size(), &fl, &sl);
+
+    TLSFBlockHeader* const head = blocks[fl][sl];
+
+    block->next_free = head;
+    block->prev_free = nullptr;
+
+    if (head)
+    {
+      head->prev_free = block;
+    }
+
+    blocks[fl][sl] = block;
+    fl_bitmap |= std::uint32_t(1u) << fl;
+    sl_bitmap[fl] |= std::uint32_t(1u) << sl;
+
+    block->SetFree(true);
+  }
+
+  void RemoveFreeBlock(TLSFBlockHeader* const block) noexcept
+  {
+    unsigned fl, sl;
+    MappingInsert(block->Size(), &fl, &sl);
+
+    TLSFBlockHeader* const prev = block->prev_free;
+    TLSFBlockHeader* const next = block->next_free;
+
+    if (next)
+    {
+      next->prev_free = prev;
+    }
+
+    if (prev)
+    {
+      prev->next_free = next;
+    }
+    else
+    {
+      blocks[fl][sl] = next;
+
+      if (!next)
+      {
+        sl_bitmap[fl] &= ~(std::uint32_t(1u) << sl);
+
+        if (!sl_bitmap[fl])
+        {
+          fl_bitmap &= ~(std::uint32_t(1u) << fl);
+        }
+      }
+    }
+
+    block->SetFree(false);
+  }
+
+  // Splits `block` so that it has a size of `size`, returning the remaining block.
+  static TLSFBlockHeader* SplitBlock(TLSFBlockHeader* const block, const MemoryIndex size) noexcept
+  {
+    TLSFBlockHeader* const remaining = reinterpret_cast<TLSFBlockHeader*>(block->Data() + size);
+
+    remaining->prev_physical  = block;
+    remaining->size_and_flags = block->Size() - size - TLSFBlockHeader::OverheadSize;
+
+    remaining->NextPhysical()->prev_physical = remaining;
+
+    block->SetSize(size);
+
+    return remaining;
+  }
+
+  static bool CanSplit(TLSFBlockHeader* const block, const MemoryIndex size) noexcept
+  {
+    return block->Size() >= size + TLSFBlockHeader::OverheadSize + TLSFBlockHeader::MinSize;
+  }
+
+  // `block` absorbs its next physical neighbor.
+  static void MergeWithNext(TLSFBlockHeader* const block) noexcept
+  {
+    TLSFBlockHeader* const next = block->NextPhysical();
+
+    block->SetSize(block->Size() + TLSFBlockHeader::OverheadSize + next->Size());
+    block->NextPhysical()->prev_physical = block;
+  }
+};
+
+Memory::TLSFAllocator::TLSFAllocator(byte* const memory_block, const MemoryIndex memory_block_size) noexcept :
+  m_Control{nullptr}
+{
+  byte* const       control_start = static_cast<byte*>(AlignPointer(memory_block, alignof(TLSFControl)));
+  byte* const       pool_start    = static_cast<byte*>(AlignPointer(control_start + sizeof(TLSFControl), TLSF::BlockAlignment));
+  const byte* const memory_end    = memory_block + memory_block_size;
+  const MemoryIndex min_pool_size = TLSFBlockHeader::OverheadSize * 2u + TLSFBlockHeader::MinSize;
+
+  if (memory_end < pool_start || MemoryIndex(memory_end - pool_start) < min_pool_size)
+  {
+    bfMemAssert(false, "Memory block too small for a TLSFAllocator, needs at least %zu bytes.", sizeof(TLSFControl) + min_pool_size);
+    return;
+  }
+
+  TLSFControl* const control = new (control_start) TLSFControl();
+
+  const MemoryIndex pool_size  = MemoryIndex(memory_end - pool_start) & TLSF::SizeMask;
+  const MemoryIndex block_size = pool_size - TLSFBlockHeader::OverheadSize * 2u;
+
+  bfMemAssert(block_size < (MemoryIndex(1u) << TLSF::FLIndexMax), "Memory block too large for a TLSFAllocator.");
+
+  TLSFBlockHeader* const block = reinterpret_cast<TLSFBlockHeader*>(pool_start);
+
+  block->prev_physical  = nullptr;
+  block->size_and_flags = block_size;
+
+  // Zero sized used sentinel so the last real block never tries to merge past the end.
+  TLSFBlockHeader* const sentinel = block->NextPhysical();
+
+  sentinel->prev_physical  = block;
+  sentinel->size_and_flags = 0u;
+
+  control->InsertFreeBlock(block);
+
+  m_Control = control;
+}
+
+AllocationResult Memory::TLSFAllocator::Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo&) noexcept
+{
+  bfMemAssert(IsValidAlignment(alignment), "The alignment (%zu) must be a non-zero power of two.", alignment);
+
+  if (!m_Control || size == 0u || size >= (MemoryIndex(1u) << TLSF::FLIndexMax))
+  {
+    return AllocationResult::Null();
+  }
+
+  const MemoryIndex aligned_size   = AlignSize(size < TLSFBlockHeader::MinSize ? TLSFBlockHeader::MinSize : size, TLSF::BlockAlignment);
+  const bool        is_overaligned = alignment > TLSF::BlockAlignment;
+  const MemoryIndex gap_min_size   = TLSFBlockHeader::OverheadSize + TLSFBlockHeader::MinSize;
+  const MemoryIndex search_size    = is_overaligned ? aligned_size + alignment + gap_min_size - TLSF::BlockAlignment : aligned_size;
+
+  unsigned fl, sl;
+  TLSFControl::MappingSearch(search_size, &fl, &sl);
+
+  TLSFBlockHeader* block = m_Control->FindSuitableBlock(&fl, &sl);
+
+  if (!block)
+  {
+    return AllocationResult::Null();
+  }
+
+  m_Control->RemoveFreeBlock(block);
+
+  if (is_overaligned)
+  {
+    byte* const data         = block->Data();
+    byte*       aligned_data = static_cast<byte*>(AlignPointer(data, alignment));
+
+    if (aligned_data != data && MemoryIndex(aligned_data - data) < gap_min_size)
+    {
+      aligned_data = static_cast<byte*>(AlignPointer(data + gap_min_size, alignment));
+    }
+
+    const MemoryIndex gap = aligned_data - data;
+
+    if (gap)
+    {
+      TLSFBlockHeader* const aligned_block = TLSFControl::SplitBlock(block, gap - TLSFBlockHeader::OverheadSize);
+
+      m_Control->InsertFreeBlock(block);
+      block = aligned_block;
+    }
+  }
+
+  if (TLSFControl::CanSplit(block, aligned_size))
+  {
+    m_Control->InsertFreeBlock(TLSFControl::SplitBlock(block, aligned_size));
+  }
+
+  return AllocationResult{block->Data(), block->Size()};
+}
+
+void Memory::TLSFAllocator::Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
+{
+  (void)alignment;
+
+  TLSFBlockHeader* block = TLSFBlockHeader::FromData(ptr);
+
+  bfMemAssert(!block->IsFree(), "Double free detected.");
+  bfMemAssert(size <= block->Size(), "Invalid number of bytes passed in.");
+  (void)size;
+
+  TLSFBlockHeader* const prev = block->prev_physical;
+
+  if (prev && prev->IsFree())
+  {
+    m_Control->RemoveFreeBlock(prev);
+    TLSFControl::MergeWithNext(prev);
+    block = prev;
+  }
+
+  TLSFBlockHeader* const next = block->NextPhysical();
+
+  if (next->IsFree())
+  {
+    m_Control->RemoveFreeBlock(next);
+    TLSFControl::MergeWithNext(block);
+  }
+
+  m_Control->InsertFreeBlock(block);
+}
+
+void Memory::TLSFAllocator::QueryStats(AllocatorStats& out_stats) const noexcept
+{
+  out_stats = {};
+
+  if (!m_Control)
+  {
+    return;
+  }
+
+  byte* const      control_start = reinterpret_cast<byte*>(m_Control);
+  TLSFBlockHeader* block         = static_cast<TLSFBlockHeader*>(AlignPointer(control_start + sizeof(TLSFControl), TLSF::BlockAlignment));
+
+  // The zero sized sentinel ends the pool, every real block is at least `MinSize`.
+  for (; block->Size() != 0u; block = block->NextPhysical())
+  {
+    if (block->IsFree())
+    {
+      // A search rounds up to the next size class so only sizes up to the start of this block's class are sure to find it.
+      const MemoryIndex size        = block->Size();
+      const MemoryIndex class_start = size < TLSF::SmallBlockSize ? size : size & ~((MemoryIndex(1u) << (TLSF::BitScanReverse(size) - TLSF::SLIndexCountLog2)) - 1u);
+
+      out_stats.free_bytes += size;
+      out_stats.num_free_blocks += 1u;
+      out_stats.largest_free_block = class_start > out_stats.largest_free_block ? class_start : out_stats.largest_free_block;
+    }
+    else
+    {
+      out_stats.used_bytes += block->Size();
+    }
+  }
+
+  out_stats.total_bytes    = MemoryIndex(block->Data() - control_start);
+  out_stats.overhead_bytes = out_stats.total_bytes - out_stats.used_bytes - out_stats.free_bytes;
+}
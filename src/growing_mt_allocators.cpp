@@ -0,0 +1,660 @@
+/******************************************************************************/
+/*!
+ * @file   growing_mt_allocators.cpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Contains growing thread-safe allocators.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#include "memory/growing_mt_allocators.hpp"
+
+#include "memory/fixed_st_allocators.hpp"  // PoolAllocator, PoolAllocatorBlock
+#include "memory/memory_api.hpp"           // bfMemAllocate, bfMemDeallocate
+
+#include <atomic>  // atomic<T*>
+
+//-------------------------------------------------------------------------------------//
+// Concurrent Growing Pool Allocator
+//-------------------------------------------------------------------------------------//
+
+Memory::ConcurrentGrowingPoolAllocator::ConcurrentGrowingPoolAllocator(
+ IPolymorphicAllocator& parent_allocator,
+ const MemoryIndex      block_size,
+ const MemoryIndex      block_alignment,
+ const MemoryIndex      num_blocks_per_chunk) noexcept :
+  m_ParentAllocator{parent_allocator},
+  m_BlockSize{block_size < sizeof(PoolAllocatorBlock) ? sizeof(PoolAllocatorBlock) : block_size},
+  m_Alignment{block_alignment < alignof(ChunkFooter) ? alignof(ChunkFooter) : block_alignment},
+  m_ChunkMemSize{AlignSize(AlignSize(m_BlockSize, m_Alignment) * num_blocks_per_chunk, alignof(ChunkFooter))},
+  m_Chunks{nullptr},
+  m_Freelist{}
+{
+  bfMemAssert(block_size > 0, "Block size must be greater than 0.");
+  bfMemAssert(num_blocks_per_chunk > 0, "Num blocks per chunk must be greater than 0.");
+}
+
+void Memory::ConcurrentGrowingPoolAllocator::Clear() noexcept
+{
+  ChunkFooter*        chunk     = m_Chunks.load(std::memory_order_acquire);
+  PoolAllocatorBlock* pool_head = nullptr;
+
+  while (chunk)
+  {
+    byte* const chunk_bytes = reinterpret_cast<byte*>(chunk) - m_ChunkMemSize;
+
+    const PoolAllocatorSetupResult chunk_pool_setup = PoolAllocator::SetupPool(chunk_bytes, m_ChunkMemSize, m_BlockSize, m_Alignment);
+
+    if (chunk_pool_setup.num_elements)
+    {
+      chunk_pool_setup.tail->next = pool_head;
+      pool_head                   = chunk_pool_setup.head;
+    }
+
+    chunk = chunk->next;
+  }
+
+  m_Freelist.Reset(pool_head);
+}
+
+void Memory::ConcurrentGrowingPoolAllocator::FreeMemory() noexcept
+{
+  ChunkFooter* chunk = m_Chunks.exchange(nullptr, std::memory_order_acquire);
+
+  m_Freelist.Reset(nullptr);
+
+  while (chunk)
+  {
+    ChunkFooter* const next_chunk = chunk->next;
+
+    byte* const chunk_bytes = reinterpret_cast<byte*>(chunk) - m_ChunkMemSize;
+
+    bfMemDeallocate(m_ParentAllocator, chunk_bytes, m_ChunkMemSize + sizeof(ChunkFooter), m_Alignment);
+
+    chunk = next_chunk;
+  }
+}
+
+AllocationResult Memory::ConcurrentGrowingPoolAllocator::Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+{
+  bfMemAssert(size <= m_BlockSize, "This Allocator is made for Objects of size %zu (not %zu)!", m_BlockSize, size);
+  bfMemAssert(alignment <= m_Alignment, "This Allocator is made for Objects of alignment %zu (not %zu)!", m_Alignment, alignment);
+
+  PoolAllocatorBlock* const block = m_Freelist.Pop();
+
+  if (block != nullptr)
+  {
+    return AllocationResult{block, m_BlockSize};
+  }
+
+  const AllocationResult new_chunk_memory = (bfMemAllocate)(m_ParentAllocator, m_ChunkMemSize + sizeof(ChunkFooter), m_Alignment, source_info);
+
+  if (new_chunk_memory)
+  {
+    byte* const        chunk_bytes = static_cast<byte*>(new_chunk_memory.ptr);
+    ChunkFooter* const new_chunk   = reinterpret_cast<ChunkFooter*>(chunk_bytes + m_ChunkMemSize);
+
+    new_chunk->next = m_Chunks.load(std::memory_order_relaxed);
+    while (!m_Chunks.compare_exchange_weak(new_chunk->next, new_chunk, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+
+    const PoolAllocatorSetupResult chunk_pool_setup = PoolAllocator::SetupPool(chunk_bytes, m_ChunkMemSize, m_BlockSize, m_Alignment);
+
+    if (chunk_pool_setup.head)
+    {
+      // The first block is handed out directly, the rest become available to every thread.
+      if (chunk_pool_setup.num_elements > 1u)
+      {
+        m_Freelist.PushList(chunk_pool_setup.head->next, chunk_pool_setup.tail);
+      }
+
+      return AllocationResult{chunk_pool_setup.head, m_BlockSize};
+    }
+  }
+
+  return AllocationResult::Null();
+}
+
+void Memory::ConcurrentGrowingPoolAllocator::Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
+{
+  bfMemAssert(size <= m_BlockSize, "That allocation did not come from this allocator (bad size).");
+  bfMemAssert(alignment <= m_Alignment, "That allocation did not come from this allocator (bad alignment).");
+
+  m_Freelist.Push(static_cast<PoolAllocatorBlock*>(ptr));
+}
+
+void Memory::ConcurrentGrowingPoolAllocator::DeallocateBatch(void* const* const ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment) noexcept
+{
+  bfMemAssert(size <= m_BlockSize, "That allocation did not come from this allocator (bad size).");
+  bfMemAssert(alignment <= m_Alignment, "That allocation did not come from this allocator (bad alignment).");
+
+  const PoolAllocatorSetupResult list = PoolAllocator::LinkBlocks(ptrs, num_ptrs);
+
+  if (list.head)
+  {
+    m_Freelist.PushList(list.head, list.tail);
+  }
+}
+
+//-------------------------------------------------------------------------------------//
+// Thread Cache Allocator
+//-------------------------------------------------------------------------------------//
+
+struct Memory::ThreadCacheBatch : public PoolAllocatorBlock
+{
+  ThreadCacheBatch* next_batch;
+};
+
+struct Memory::ThreadCacheSpan
+{
+  // byte[m_SpanSize];
+  ThreadCacheSpan* next;
+};
+
+struct Memory::ThreadCacheAllocator::ThreadCache
+{
+  struct Bin
+  {
+    PoolAllocatorBlock* head;
+    MemoryIndex         count;
+  };
+
+  std::atomic<ThreadCacheAllocator*> owner;
+  ThreadCache*                       next_registered;
+  Bin                                bins[NumSizeClasses];
+};
+
+namespace ThreadCaching
+{
+  using namespace Memory;
+
+  static constexpr MemoryIndex SizeClassGranularity = 16u;
+  static constexpr MemoryIndex MaxBatchBytes        = bfKilobytes(4);
+  static constexpr MemoryIndex MaxCachesPerThread   = 8u;
+
+  static constexpr MemoryIndex SizeClassSizes[ThreadCacheAllocator::NumSizeClasses] = {
+   16u, 32u, 48u, 64u, 80u, 96u, 112u, 128u,
+   160u, 192u, 224u, 256u,
+   320u, 384u, 448u, 512u,
+   640u, 768u, 896u, 1024u,
+  };
+
+  static_assert(SizeClassSizes[ThreadCacheAllocator::NumSizeClasses - 1u] == ThreadCacheAllocator::MaxCachedSize, "The largest size class must be the max cached size.");
+  static_assert(SizeClassSizes[0] >= sizeof(ThreadCacheBatch), "Each block must be able to store a batch header.");
+
+  struct SizeClassLUT
+  {
+    unsigned char size_class[ThreadCacheAllocator::MaxCachedSize / SizeClassGranularity + 1u];
+    MemoryIndex   batch_count[ThreadCacheAllocator::NumSizeClasses];
+  };
+
+  static constexpr SizeClassLUT MakeSizeClassLUT()
+  {
+    SizeClassLUT result = {};
+
+    MemoryIndex size_class = 0u;
+    for (MemoryIndex index = 0u; index < sizeof(result.size_class); ++index)
+    {
+      while (SizeClassSizes[size_class] < index * SizeClassGranularity)
+      {
+        ++size_class;
+      }
+
+      result.size_class[index] = static_cast<unsigned char>(size_class);
+    }
+
+    for (MemoryIndex index = 0u; index < ThreadCacheAllocator::NumSizeClasses; ++index)
+    {
+      const MemoryIndex batch_count = MaxBatchBytes / SizeClassSizes[index];
+
+      result.batch_count[index] = batch_count < 4u ? 4u : batch_count > 64u ? 64u : batch_count;
+    }
+
+    return result;
+  }
+
+  static constexpr SizeClassLUT LUT = MakeSizeClassLUT();
+
+  static MemoryIndex SizeClassOf(const MemoryIndex size) noexcept
+  {
+    return LUT.size_class[(size + (SizeClassGranularity - 1u)) / SizeClassGranularity];
+  }
+
+  static MemoryIndex BatchCount(const MemoryIndex size_class) noexcept
+  {
+    return LUT.batch_count[size_class];
+  }
+
+  static bool IsCachedAllocation(const MemoryIndex size, const MemoryIndex alignment) noexcept
+  {
+    return size <= ThreadCacheAllocator::MaxCachedSize && alignment <= ThreadCacheAllocator::CachedAlignment;
+  }
+
+  /*!
+   * @brief
+   *   Thread caches are stored in plain (trivially destructible) thread local storage
+   *   so that they can still be queried safely during thread shutdown.
+   */
+  struct ThreadCacheTable
+  {
+    ThreadCacheAllocator::ThreadCache caches[MaxCachesPerThread];
+    bool                              is_shutdown;
+  };
+
+  static thread_local ThreadCacheTable t_Table = {};
+  static std::mutex                    s_RegistryLock;  //!< Guards `ThreadCache::owner` writes and `ThreadCacheAllocator::m_RegisteredCaches`.
+
+  static ThreadCacheBatch* CutBatch(ThreadCacheAllocator::ThreadCache::Bin& bin, const MemoryIndex batch_count) noexcept
+  {
+    PoolAllocatorBlock* const head = bin.head;
+    PoolAllocatorBlock*       last = head;
+
+    for (MemoryIndex index = 1u; index < batch_count; ++index)
+    {
+      last = last->next;
+    }
+
+    bin.head   = last->next;
+    bin.count -= batch_count;
+    last->next = nullptr;
+
+    return static_cast<ThreadCacheBatch*>(head);
+  }
+
+  static PoolAllocatorBlock* FindTail(PoolAllocatorBlock* block) noexcept
+  {
+    while (block->next)
+    {
+      block = block->next;
+    }
+
+    return block;
+  }
+}  // namespace ThreadCaching
+
+/*!
+ * @brief
+ *   Has a non-trivial destructor so that thread caches are flushed on thread exit,
+ *   only constructed once a thread has registered a cache.
+ */
+struct Memory::ThreadCacheTableCleanup
+{
+  void Touch() noexcept {}
+
+  ~ThreadCacheTableCleanup() noexcept
+  {
+    const std::lock_guard<std::mutex> guard{ThreadCaching::s_RegistryLock};
+
+    ThreadCaching::t_Table.is_shutdown = true;
+
+    for (ThreadCacheAllocator::ThreadCache& cache : ThreadCaching::t_Table.caches)
+    {
+      ThreadCacheAllocator* const owner = cache.owner.load(std::memory_order_relaxed);
+
+      if (owner)
+      {
+        owner->FlushThreadCache(cache);
+
+        ThreadCacheAllocator::ThreadCache** link = &owner->m_RegisteredCaches;
+
+        while (*link != &cache)
+        {
+          link = &(*link)->next_registered;
+        }
+
+        *link = cache.next_registered;
+        cache.owner.store(nullptr, std::memory_order_relaxed);
+      }
+    }
+  }
+};
+
+static thread_local Memory::ThreadCacheTableCleanup t_ThreadCacheCleanup = {};
+
+Memory::ThreadCacheAllocator::ThreadCacheAllocator(IPolymorphicAllocator& parent_allocator, const MemoryIndex span_size) noexcept :
+  m_ParentAllocator{parent_allocator},
+  m_SpanSize{AlignSize(span_size, alignof(ThreadCacheSpan))},
+  m_RegisteredCaches{nullptr},
+  m_Depots{}
+{
+  bfMemAssert(span_size >= ThreadCaching::MaxBatchBytes, "Span size must be able to hold at least one batch of blocks (%zu bytes).", ThreadCaching::MaxBatchBytes);
+}
+
+AllocationResult Memory::ThreadCacheAllocator::Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+{
+  if (ThreadCaching::IsCachedAllocation(size, alignment))
+  {
+    const MemoryIndex size_class = ThreadCaching::SizeClassOf(size);
+    const MemoryIndex block_size = ThreadCaching::SizeClassSizes[size_class];
+    ThreadCache*      cache      = FindThreadCache();
+
+    if (cache)
+    {
+      ThreadCache::Bin& bin = cache->bins[size_class];
+
+      if (!bin.head)
+      {
+        bin.head = RefillFromDepot(size_class, &bin.count);
+      }
+
+      PoolAllocatorBlock* const block = bin.head;
+
+      if (block)
+      {
+        bin.head = block->next;
+        --bin.count;
+
+        return AllocationResult{block, block_size};
+      }
+
+      return AllocationResult::Null();
+    }
+
+    // No cache slot left for this thread, take a single block straight from the depot.
+
+    MemoryIndex               count = 0u;
+    PoolAllocatorBlock* const block = RefillFromDepot(size_class, &count);
+
+    if (block)
+    {
+      if (block->next)
+      {
+        ReturnBlocksToDepot(size_class, block->next, ThreadCaching::FindTail(block->next), count - 1u);
+      }
+
+      return AllocationResult{block, block_size};
+    }
+
+    return AllocationResult::Null();
+  }
+
+  return (bfMemAllocate)(m_ParentAllocator, size, alignment, source_info);
+}
+
+void Memory::ThreadCacheAllocator::Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
+{
+  if (ThreadCaching::IsCachedAllocation(size, alignment))
+  {
+    const MemoryIndex         size_class = ThreadCaching::SizeClassOf(size);
+    PoolAllocatorBlock* const block      = static_cast<PoolAllocatorBlock*>(ptr);
+    ThreadCache* const        cache      = FindThreadCache();
+
+    if (cache)
+    {
+      ThreadCache::Bin& bin         = cache->bins[size_class];
+      const MemoryIndex batch_count = ThreadCaching::BatchCount(size_class);
+
+      block->next = bin.head;
+      bin.head    = block;
+      ++bin.count;
+
+      if (bin.count >= batch_count * 2u)
+      {
+        ReturnBatchToDepot(size_class, ThreadCaching::CutBatch(bin, batch_count));
+      }
+    }
+    else
+    {
+      ReturnBlocksToDepot(size_class, block, block, 1u);
+    }
+  }
+  else
+  {
+    bfMemDeallocate(m_ParentAllocator, ptr, size, alignment);
+  }
+}
+
+void Memory::ThreadCacheAllocator::FlushThreadCache() noexcept
+{
+  for (ThreadCache& cache : ThreadCaching::t_Table.caches)
+  {
+    if (cache.owner.load(std::memory_order_relaxed) == this)
+    {
+      FlushThreadCache(cache);
+      break;
+    }
+  }
+}
+
+Memory::ThreadCacheAllocator::~ThreadCacheAllocator() noexcept
+{
+  {
+    const std::lock_guard<std::mutex> guard{ThreadCaching::s_RegistryLock};
+
+    for (ThreadCache* cache = m_RegisteredCaches; cache; cache = cache->next_registered)
+    {
+      cache->owner.store(nullptr, std::memory_order_relaxed);
+    }
+
+    m_RegisteredCaches = nullptr;
+  }
+
+  for (SizeClassDepot& depot : m_Depots)
+  {
+    ThreadCacheSpan* span = depot.spans;
+
+    while (span)
+    {
+      ThreadCacheSpan* const next_span  = span->next;
+      byte* const            span_bytes = reinterpret_cast<byte*>(span) - m_SpanSize;
+
+      bfMemDeallocate(m_ParentAllocator, span_bytes, m_SpanSize + sizeof(ThreadCacheSpan), CachedAlignment);
+
+      span = next_span;
+    }
+  }
+}
+
+Memory::ThreadCacheAllocator::ThreadCache* Memory::ThreadCacheAllocator::FindThreadCache() noexcept
+{
+  for (ThreadCache& cache : ThreadCaching::t_Table.caches)
+  {
+    if (cache.owner.load(std::memory_order_relaxed) == this)
+    {
+      return &cache;
+    }
+  }
+
+  return RegisterThreadCache();
+}
+
+Memory::ThreadCacheAllocator::ThreadCache* Memory::ThreadCacheAllocator::RegisterThreadCache() noexcept
+{
+  if (ThreadCaching::t_Table.is_shutdown)
+  {
+    return nullptr;
+  }
+
+  t_ThreadCacheCleanup.Touch();
+
+  const std::lock_guard<std::mutex> guard{ThreadCaching::s_RegistryLock};
+
+  for (ThreadCache& cache : ThreadCaching::t_Table.caches)
+  {
+    if (cache.owner.load(std::memory_order_relaxed) == nullptr)
+    {
+      for (ThreadCache::Bin& bin : cache.bins)
+      {
+        bin.head  = nullptr;
+        bin.count = 0u;
+      }
+
+      cache.next_registered = m_RegisteredCaches;
+      m_RegisteredCaches    = &cache;
+      cache.owner.store(this, std::memory_order_relaxed);
+
+      return &cache;
+    }
+  }
+
+  return nullptr;
+}
+
+Memory::PoolAllocatorBlock* Memory::ThreadCacheAllocator::RefillFromDepot(const MemoryIndex size_class, MemoryIndex* const out_count) noexcept
+{
+  SizeClassDepot&   depot       = m_Depots[size_class];
+  const MemoryIndex batch_count = ThreadCaching::BatchCount(size_class);
+
+  {
+    const std::lock_guard<std::mutex> guard{depot.lock};
+
+    if (depot.full_batches)
+    {
+      ThreadCacheBatch* const batch = depot.full_batches;
+
+      depot.full_batches = batch->next_batch;
+      *out_count         = batch_count;
+
+      return batch;
+    }
+
+    if (depot.partial_head)
+    {
+      PoolAllocatorBlock* const blocks = depot.partial_head;
+
+      *out_count          = depot.partial_count;
+      depot.partial_head  = nullptr;
+      depot.partial_count = 0u;
+
+      return blocks;
+    }
+  }
+
+  // Depot is empty, carve a new span into batches outside of the lock.
+
+  const MemoryIndex block_size  = ThreadCaching::SizeClassSizes[size_class];
+  const MemoryIndex batch_bytes = block_size * batch_count;
+  const MemoryIndex num_batches = m_SpanSize / batch_bytes;
+
+  // The constructor asserts this, release builds must still not wrap `num_batches - 1u`.
+  if (num_batches == 0u)
+  {
+    *out_count = 0u;
+    return nullptr;
+  }
+
+  const AllocationResult span_memory = (bfMemAllocate)(m_ParentAllocator, m_SpanSize + sizeof(ThreadCacheSpan), CachedAlignment, MemoryMakeAllocationSourceInfo());
+
+  if (!span_memory)
+  {
+    *out_count = 0u;
+    return nullptr;
+  }
+
+  byte* const            span_bytes = static_cast<byte*>(span_memory.ptr);
+  ThreadCacheSpan* const span       = reinterpret_cast<ThreadCacheSpan*>(span_bytes + m_SpanSize);
+
+  ThreadCacheBatch* batches = nullptr;
+
+  // The first batch is handed back to the caller.
+  for (MemoryIndex batch_index = num_batches - 1u; batch_index > 0u; --batch_index)
+  {
+    const PoolAllocatorSetupResult setup = PoolAllocator::SetupPool(span_bytes + batch_bytes * batch_index, batch_bytes, block_size, CachedAlignment);
+    ThreadCacheBatch* const        batch = static_cast<ThreadCacheBatch*>(setup.head);
+
+    batch->next_batch = batches;
+    batches           = batch;
+  }
+
+  const PoolAllocatorSetupResult first_batch = PoolAllocator::SetupPool(span_bytes, batch_bytes, block_size, CachedAlignment);
+  const PoolAllocatorSetupResult leftover    = PoolAllocator::SetupPool(span_bytes + batch_bytes * num_batches, m_SpanSize - batch_bytes * num_batches, block_size, CachedAlignment);
+
+  {
+    const std::lock_guard<std::mutex> guard{depot.lock};
+
+    span->next  = depot.spans;
+    depot.spans = span;
+
+    if (batches)
+    {
+      ThreadCacheBatch* last_batch = batches;
+
+      while (last_batch->next_batch)
+      {
+        last_batch = last_batch->next_batch;
+      }
+
+      last_batch->next_batch = depot.full_batches;
+      depot.full_batches     = batches;
+    }
+
+    if (leftover.num_elements)
+    {
+      leftover.tail->next = depot.partial_head;
+      depot.partial_head  = leftover.head;
+      depot.partial_count += leftover.num_elements;
+    }
+  }
+
+  *out_count = first_batch.num_elements;
+  return first_batch.head;
+}
+
+void Memory::ThreadCacheAllocator::ReturnBatchToDepot(const MemoryIndex size_class, ThreadCacheBatch* const batch) noexcept
+{
+  SizeClassDepot&                   depot = m_Depots[size_class];
+  const std::lock_guard<std::mutex> guard{depot.lock};
+
+  batch->next_batch  = depot.full_batches;
+  depot.full_batches = batch;
+}
+
+void Memory::ThreadCacheAllocator::ReturnBlocksToDepot(const MemoryIndex size_class, PoolAllocatorBlock* const head, PoolAllocatorBlock* const tail, const MemoryIndex count) noexcept
+{
+  SizeClassDepot&                   depot = m_Depots[size_class];
+  const std::lock_guard<std::mutex> guard{depot.lock};
+
+  tail->next         = depot.partial_head;
+  depot.partial_head = head;
+  depot.partial_count += count;
+}
+
+void Memory::ThreadCacheAllocator::FlushThreadCache(ThreadCache& cache) noexcept
+{
+  for (MemoryIndex size_class = 0u; size_class < NumSizeClasses; ++size_class)
+  {
+    ThreadCache::Bin& bin         = cache.bins[size_class];
+    const MemoryIndex batch_count = ThreadCaching::BatchCount(size_class);
+
+    while (bin.count >= batch_count)
+    {
+      ReturnBatchToDepot(size_class, ThreadCaching::CutBatch(bin, batch_count));
+    }
+
+    if (bin.head)
+    {
+      ReturnBlocksToDepot(size_class, bin.head, ThreadCaching::FindTail(bin.head), bin.count);
+
+      bin.head  = nullptr;
+      bin.count = 0u;
+    }
+  }
+}
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
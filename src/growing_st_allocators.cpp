@@ -4,61 +4,149 @@
 
 #include "memory/memory_api.hpp"  // bfMemAllocate, bfMemDeallocate
 
+#include <cstring>  // memcpy
+
+//-------------------------------------------------------------------------------------//
+// Growing Pool Allocator
+//-------------------------------------------------------------------------------------//
+
+namespace GrowingPool
+{
+  template<typename T>
+  static void ListPush(T*& head, T* const node) noexcept
+  {
+    node->prev = nullptr;
+    node->next = head;
+
+    if (head)
+    {
+      head->prev = node;
+    }
+
+    head = node;
+  }
+
+  template<typename T>
+  static void ListRemove(T*& head, T* const node) noexcept
+  {
+    if (node->prev)
+    {
+      node->prev->next = node->next;
+    }
+    else
+    {
+      head = node->next;
+    }
+
+    if (node->next)
+    {
+      node->next->prev = node->prev;
+    }
+  }
+}  // namespace GrowingPool
+
 Memory::GrowingPoolAllocator::GrowingPoolAllocator(
- IPolymorphicAllocator&       parent_allocator,
- const MemoryIndex block_size,
- const MemoryIndex block_alignment,
- const MemoryIndex num_blocks_per_chunk) noexcept :
+ IPolymorphicAllocator& parent_allocator,
+ const MemoryIndex      block_size,
+ const MemoryIndex      block_alignment,
+ const MemoryIndex      num_blocks_per_chunk,
+ const bool             track_chunks,
+ const MemoryIndex      free_chunk_slack,
+ IPolymorphicAllocator& index_allocator) noexcept :
   m_ParentAllocator{parent_allocator},
-  m_BlockSize{block_size < sizeof(PoolAllocatorBlock) ? sizeof(PoolAllocatorBlock) : block_size},
+  m_IndexAllocator{index_allocator},
+  m_BlockSize{AlignSize(block_size < sizeof(PoolAllocatorBlock) ? sizeof(PoolAllocatorBlock) : block_size, block_alignment < alignof(ChunkFooter) ? alignof(ChunkFooter) : block_alignment)},
   m_Alignment{block_alignment < alignof(ChunkFooter) ? alignof(ChunkFooter) : block_alignment},
   m_ChunkMemSize{AlignSize(m_BlockSize * num_blocks_per_chunk, alignof(ChunkFooter))},
-  m_Chunks{nullptr},
-  m_PoolHead{nullptr}
+  m_NumBlocksPerChunk{num_blocks_per_chunk},
+  m_ChunkIndex{nullptr},
+  m_ChunkById{nullptr},
+  m_NumChunks{0u},
+  m_NumChunkIds{0u},
+  m_ChunkIndexCapacity{0u},
+  m_PoolHead{nullptr},
+  m_BumpCurrent{nullptr},
+  m_BumpEnd{nullptr},
+  m_NextUntouchedChunk{0u},
+  m_PartialChunks{nullptr},
+  m_FreeChunks{nullptr},
+  m_NumFreeChunks{0u},
+  m_FreeChunkSlack{free_chunk_slack},
+  m_TrackChunks{track_chunks}
 {
   bfMemAssert(block_size > 0, "Block size must be greater than 0.");
   bfMemAssert(num_blocks_per_chunk > 0, "Num blocks per chunk must be greater than 0.");
 }
 
-void Memory::GrowingPoolAllocator::Clear() noexcept
+MemoryIndex Memory::GrowingPoolAllocator::NumBlocksPerChunkForSize(const MemoryIndex block_size, const MemoryIndex block_alignment, const MemoryIndex chunk_size) noexcept
 {
-  ChunkFooter* chunk = m_Chunks;
+  const MemoryIndex alignment         = block_alignment < alignof(ChunkFooter) ? alignof(ChunkFooter) : block_alignment;
+  const MemoryIndex aligned_block     = AlignSize(block_size < sizeof(PoolAllocatorBlock) ? sizeof(PoolAllocatorBlock) : block_size, alignment);
+  const MemoryIndex usable_chunk_size = chunk_size > sizeof(ChunkFooter) ? chunk_size - sizeof(ChunkFooter) : 0u;
+  const MemoryIndex num_blocks        = usable_chunk_size / aligned_block;
 
-  m_PoolHead = nullptr;
+  return num_blocks != 0u ? num_blocks : 1u;
+}
 
-  while (chunk)
-  {
-    byte* const chunk_bytes = reinterpret_cast<byte*>(chunk) - m_ChunkMemSize;
+void Memory::GrowingPoolAllocator::Clear() noexcept
+{
+  m_PoolHead           = nullptr;
+  m_BumpCurrent        = nullptr;
+  m_BumpEnd            = nullptr;
+  m_NextUntouchedChunk = 0u;
 
-    const PoolAllocatorSetupResult chunk_pool_setup = PoolAllocator::SetupPool(chunk_bytes, m_ChunkMemSize, m_BlockSize, m_Alignment);
+  if (m_TrackChunks)
+  {
+    m_PartialChunks = nullptr;
+    m_FreeChunks    = nullptr;
+    m_NumFreeChunks = m_NumChunks;
 
-    if (chunk_pool_setup.num_elements)
+    for (MemoryIndex i = 0u; i < m_NumChunks; ++i)
     {
-      chunk_pool_setup.tail->next = m_PoolHead;
-      m_PoolHead                  = chunk_pool_setup.head;
+      ChunkFooter* const chunk = m_ChunkIndex[i];
+
+      chunk->prev       = nullptr;
+      chunk->next       = m_FreeChunks;
+      chunk->free_list  = nullptr;
+      chunk->num_live   = 0u;
+      chunk->num_bumped = 0u;
+
+      if (m_FreeChunks)
+      {
+        m_FreeChunks->prev = chunk;
+      }
+
+      m_FreeChunks = chunk;
     }
 
-    chunk = chunk->next;
+    TrimToSlack();
   }
 }
 
 void Memory::GrowingPoolAllocator::FreeMemory() noexcept
 {
-  ChunkFooter* chunk = m_Chunks;
-
-  m_Chunks   = nullptr;
-  m_PoolHead = nullptr;
-
-  while (chunk)
+  for (MemoryIndex i = 0u; i < m_NumChunks; ++i)
   {
-    ChunkFooter* const next_chunk = chunk->next;
-
-    byte* const chunk_bytes = reinterpret_cast<byte*>(chunk) - m_ChunkMemSize;
-
-    bfMemDeallocate(m_ParentAllocator, chunk_bytes, m_ChunkMemSize + sizeof(ChunkFooter), m_Alignment);
+    bfMemDeallocate(m_ParentAllocator, ChunkBgn(m_ChunkIndex[i]), m_ChunkMemSize + sizeof(ChunkFooter), m_Alignment);
+  }
 
-    chunk = next_chunk;
+  if (m_ChunkIndex)
+  {
+    bfMemDeallocate(m_IndexAllocator, m_ChunkIndex, sizeof(ChunkFooter*) * m_ChunkIndexCapacity * 2u, alignof(ChunkFooter*));
   }
+
+  m_ChunkIndex         = nullptr;
+  m_ChunkById          = nullptr;
+  m_NumChunks          = 0u;
+  m_NumChunkIds        = 0u;
+  m_ChunkIndexCapacity = 0u;
+  m_PoolHead           = nullptr;
+  m_BumpCurrent        = nullptr;
+  m_BumpEnd            = nullptr;
+  m_NextUntouchedChunk = 0u;
+  m_PartialChunks      = nullptr;
+  m_FreeChunks         = nullptr;
+  m_NumFreeChunks      = 0u;
 }
 
 AllocationResult Memory::GrowingPoolAllocator::Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
@@ -66,8 +154,14 @@ AllocationResult Memory::GrowingPoolAllocator::Allocate(const MemoryIndex size,
   bfMemAssert(size <= m_BlockSize, "This Allocator is made for Objects of size %zu (not %zu)!", m_BlockSize, size);
   bfMemAssert(alignment <= m_Alignment, "This Allocator is made for Objects of alignment %zu (not %zu)!", m_Alignment, alignment);
 
-pool_alloc:
-  PoolAllocatorBlock* const block = m_PoolHead;
+  if (m_TrackChunks)
+  {
+    PoolAllocatorBlock* const block = AllocateTracked(source_info);
+
+    return block ? AllocationResult{reinterpret_cast<void*>(block), m_BlockSize} : AllocationResult::Null();
+  }
+
+  PoolAllocatorBlock* block = m_PoolHead;
 
   if (block != nullptr)
   {
@@ -76,6 +170,321 @@ pool_alloc:
     return AllocationResult{reinterpret_cast<void*>(block), m_BlockSize};
   }
 
+  block = BumpBlock();
+
+  if (block == nullptr && GrowChunk(source_info))
+  {
+    block = BumpBlock();
+  }
+
+  if (block != nullptr)
+  {
+    return AllocationResult{reinterpret_cast<void*>(block), m_BlockSize};
+  }
+
+  return AllocationResult::Null();
+}
+
+void Memory::GrowingPoolAllocator::Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
+{
+  bfMemAssert(size <= m_BlockSize, "That allocation did not come from this allocator (bad size).");
+  bfMemAssert(alignment <= m_Alignment, "That allocation did not come from this allocator (bad alignment).");
+
+  bfMemAssert(IsPtrInRange(ptr), "That allocation did not come from this allocator.");
+
+  if (m_TrackChunks)
+  {
+    DeallocateTracked(ptr);
+    return;
+  }
+
+  PoolAllocatorBlock* const block = static_cast<PoolAllocatorBlock*>(ptr);
+
+  block->next = m_PoolHead;
+  m_PoolHead  = block;
+}
+
+MemoryIndex Memory::GrowingPoolAllocator::AllocateBatch(void** const out_ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+{
+  bfMemAssert(size <= m_BlockSize, "This Allocator is made for Objects of size %zu (not %zu)!", m_BlockSize, size);
+  bfMemAssert(alignment <= m_Alignment, "This Allocator is made for Objects of alignment %zu (not %zu)!", m_Alignment, alignment);
+
+  if (m_TrackChunks)
+  {
+    MemoryIndex num_allocated = 0u;
+
+    while (num_allocated < num_ptrs)
+    {
+      PoolAllocatorBlock* const block = AllocateTracked(source_info);
+
+      if (block == nullptr)
+      {
+        break;
+      }
+
+      out_ptrs[num_allocated++] = block;
+    }
+
+    return num_allocated;
+  }
+
+  MemoryIndex num_allocated = PoolAllocator::PopBlocks(&m_PoolHead, out_ptrs, num_ptrs);
+
+  while (num_allocated < num_ptrs)
+  {
+    PoolAllocatorBlock* const block = BumpBlock();
+
+    if (block != nullptr)
+    {
+      out_ptrs[num_allocated++] = block;
+    }
+    else if (!GrowChunk(source_info))
+    {
+      break;
+    }
+  }
+
+  return num_allocated;
+}
+
+void Memory::GrowingPoolAllocator::DeallocateBatch(void* const* const ptrs, const MemoryIndex num_ptrs, const MemoryIndex size, const MemoryIndex alignment) noexcept
+{
+  bfMemAssert(size <= m_BlockSize, "That allocation did not come from this allocator (bad size).");
+  bfMemAssert(alignment <= m_Alignment, "That allocation did not come from this allocator (bad alignment).");
+
+  if (m_TrackChunks)
+  {
+    for (MemoryIndex i = 0u; i < num_ptrs; ++i)
+    {
+      DeallocateTracked(ptrs[i]);
+    }
+
+    return;
+  }
+
+#if BF_MEMORY_ASSERTIONS
+  for (MemoryIndex i = 0u; i < num_ptrs; ++i)
+  {
+    bfMemAssert(IsPtrInRange(ptrs[i]), "That allocation did not come from this allocator.");
+  }
+#endif
+
+  PoolAllocator::PushBlocks(&m_PoolHead, ptrs, num_ptrs);
+}
+
+MemoryIndex Memory::GrowingPoolAllocator::IndexOf(const void* ptr) const noexcept
+{
+  ChunkFooter* const chunk = FindChunk(ptr);
+
+  bfMemAssert(chunk != nullptr, "Pointer does not belong to this pool.");
+
+  return chunk->id * m_NumBlocksPerChunk + MemoryIndex(static_cast<const byte*>(ptr) - ChunkBgn(chunk)) / m_BlockSize;
+}
+
+void* Memory::GrowingPoolAllocator::FromIndex(const MemoryIndex index) const noexcept
+{
+  const MemoryIndex chunk_id = index / m_NumBlocksPerChunk;
+
+  bfMemAssert(chunk_id < m_NumChunkIds && m_ChunkById[chunk_id] != nullptr, "Invalid index");
+
+  return ChunkBgn(m_ChunkById[chunk_id]) + (index % m_NumBlocksPerChunk) * m_BlockSize;
+}
+
+MemoryIndex Memory::GrowingPoolAllocator::Trim() noexcept
+{
+  MemoryIndex num_released = 0u;
+
+  while (m_FreeChunks)
+  {
+    ReleaseChunk(m_FreeChunks);
+    ++num_released;
+  }
+
+  return num_released;
+}
+
+void Memory::GrowingPoolAllocator::QueryStats(AllocatorStats& out_stats) const noexcept
+{
+  MemoryIndex num_free = 0u;
+
+  if (m_TrackChunks)
+  {
+    for (MemoryIndex i = 0u; i < m_NumChunks; ++i)
+    {
+      num_free += m_NumBlocksPerChunk - m_ChunkIndex[i]->num_live;
+    }
+  }
+  else
+  {
+    for (const PoolAllocatorBlock* block = m_PoolHead; block; block = block->next)
+    {
+      ++num_free;
+    }
+
+    num_free += MemoryIndex(m_BumpEnd - m_BumpCurrent) / m_BlockSize;
+    num_free += (m_NumChunks - m_NextUntouchedChunk) * m_NumBlocksPerChunk;
+  }
+
+  const MemoryIndex num_blocks       = m_NumChunks * m_NumBlocksPerChunk;
+  const MemoryIndex chunk_index_size = m_ChunkIndex ? sizeof(ChunkFooter*) * m_ChunkIndexCapacity * 2u : 0u;
+
+  out_stats.total_bytes        = m_NumChunks * (m_ChunkMemSize + sizeof(ChunkFooter)) + chunk_index_size;
+  out_stats.used_bytes         = (num_blocks - num_free) * m_BlockSize;
+  out_stats.free_bytes         = num_free * m_BlockSize;
+  out_stats.overhead_bytes     = out_stats.total_bytes - out_stats.used_bytes - out_stats.free_bytes;
+  out_stats.largest_free_block = num_free != 0u ? m_BlockSize : 0u;
+  out_stats.num_free_blocks    = num_free;
+}
+
+Memory::GrowingPoolAllocator::ChunkFooter* Memory::GrowingPoolAllocator::FindChunk(const void* const ptr) const noexcept
+{
+  // First chunk whose footer is past `ptr`, the footer marks the end of a chunk's blocks.
+  MemoryIndex low  = 0u;
+  MemoryIndex high = m_NumChunks;
+
+  while (low < high)
+  {
+    const MemoryIndex mid = low + (high - low) / 2u;
+
+    if (reinterpret_cast<const byte*>(m_ChunkIndex[mid]) <= static_cast<const byte*>(ptr))
+    {
+      low = mid + 1u;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+
+  if (low != m_NumChunks && ChunkBgn(m_ChunkIndex[low]) <= static_cast<const byte*>(ptr))
+  {
+    return m_ChunkIndex[low];
+  }
+
+  return nullptr;
+}
+
+Memory::PoolAllocatorBlock* Memory::GrowingPoolAllocator::BumpBlock() noexcept
+{
+  while (MemoryIndex(m_BumpEnd - m_BumpCurrent) < m_BlockSize)
+  {
+    if (m_NextUntouchedChunk == m_NumChunks)
+    {
+      return nullptr;
+    }
+
+    ChunkFooter* const chunk = m_ChunkIndex[m_NextUntouchedChunk++];
+
+    m_BumpCurrent = ChunkBgn(chunk);
+    m_BumpEnd     = reinterpret_cast<byte*>(chunk);
+  }
+
+  byte* const block = m_BumpCurrent;
+  m_BumpCurrent += m_BlockSize;
+
+  return reinterpret_cast<PoolAllocatorBlock*>(block);
+}
+
+Memory::PoolAllocatorBlock* Memory::GrowingPoolAllocator::AllocateTracked(const AllocationSourceInfo& source_info) noexcept
+{
+  // Partially full chunks first so the free chunks stay free and can be trimmed.
+  ChunkFooter* chunk = m_PartialChunks;
+
+  if (!chunk)
+  {
+    if (!m_FreeChunks && !GrowChunk(source_info))
+    {
+      return nullptr;
+    }
+
+    chunk = m_FreeChunks;
+
+    GrowingPool::ListRemove(m_FreeChunks, chunk);
+    GrowingPool::ListPush(m_PartialChunks, chunk);
+    --m_NumFreeChunks;
+  }
+
+  PoolAllocatorBlock* block = chunk->free_list;
+
+  if (block)
+  {
+    chunk->free_list = block->next;
+  }
+  else
+  {
+    block = reinterpret_cast<PoolAllocatorBlock*>(ChunkBgn(chunk) + chunk->num_bumped * m_BlockSize);
+    ++chunk->num_bumped;
+  }
+
+  if (++chunk->num_live == m_NumBlocksPerChunk)
+  {
+    GrowingPool::ListRemove(m_PartialChunks, chunk);
+    chunk->prev = nullptr;
+    chunk->next = nullptr;
+  }
+
+  return block;
+}
+
+void Memory::GrowingPoolAllocator::DeallocateTracked(void* const ptr) noexcept
+{
+  ChunkFooter* const chunk = FindChunk(ptr);
+
+  bfMemAssert(chunk != nullptr, "That allocation did not come from this allocator.");
+  bfMemAssert(chunk->num_live != 0u, "Double free of a block from this allocator.");
+
+  PoolAllocatorBlock* const block = static_cast<PoolAllocatorBlock*>(ptr);
+
+  block->next      = chunk->free_list;
+  chunk->free_list = block;
+
+  if (chunk->num_live-- == m_NumBlocksPerChunk)
+  {
+    GrowingPool::ListPush(m_PartialChunks, chunk);
+  }
+
+  if (chunk->num_live == 0u)
+  {
+    // The chunk's blocks no longer need a freelist, bumping from the start again keeps reuse in address order.
+    chunk->free_list  = nullptr;
+    chunk->num_bumped = 0u;
+
+    GrowingPool::ListRemove(m_PartialChunks, chunk);
+    GrowingPool::ListPush(m_FreeChunks, chunk);
+    ++m_NumFreeChunks;
+
+    TrimToSlack();
+  }
+}
+
+bool Memory::GrowingPoolAllocator::GrowChunk(const AllocationSourceInfo& source_info) noexcept
+{
+  // Ids in use never exceed `m_NumChunks` so a full sorted index is the only time the id table can be full too.
+  if (m_NumChunks == m_ChunkIndexCapacity)
+  {
+    const MemoryIndex      new_capacity = m_ChunkIndexCapacity ? m_ChunkIndexCapacity * 2u : 8u;
+    const AllocationResult new_index    = (bfMemAllocate)(m_IndexAllocator, sizeof(ChunkFooter*) * new_capacity * 2u, alignof(ChunkFooter*), source_info);
+
+    if (!new_index)
+    {
+      return false;
+    }
+
+    ChunkFooter** const new_chunk_index = static_cast<ChunkFooter**>(new_index.ptr);
+    ChunkFooter** const new_chunk_by_id = new_chunk_index + new_capacity;
+
+    if (m_ChunkIndex)
+    {
+      std::memcpy(new_chunk_index, m_ChunkIndex, sizeof(ChunkFooter*) * m_NumChunks);
+      std::memcpy(new_chunk_by_id, m_ChunkById, sizeof(ChunkFooter*) * m_NumChunkIds);
+      bfMemDeallocate(m_IndexAllocator, m_ChunkIndex, sizeof(ChunkFooter*) * m_ChunkIndexCapacity * 2u, alignof(ChunkFooter*));
+    }
+
+    m_ChunkIndex         = new_chunk_index;
+    m_ChunkById          = new_chunk_by_id;
+    m_ChunkIndexCapacity = new_capacity;
+  }
+
   const AllocationResult new_chunk_memory = (bfMemAllocate)(m_ParentAllocator, m_ChunkMemSize + sizeof(ChunkFooter), m_Alignment, source_info);
 
   if (new_chunk_memory)
@@ -83,28 +492,325 @@ pool_alloc:
     byte* const        chunk_bytes = static_cast<byte*>(new_chunk_memory.ptr);
     ChunkFooter* const new_chunk   = reinterpret_cast<ChunkFooter*>(chunk_bytes + m_ChunkMemSize);
 
-    new_chunk->next = m_Chunks;
-    m_Chunks        = new_chunk;
+    MemoryIndex insert_index = m_NumChunks;
+
+    while (insert_index != 0u && m_ChunkIndex[insert_index - 1u] > new_chunk)
+    {
+      m_ChunkIndex[insert_index] = m_ChunkIndex[insert_index - 1u];
+      --insert_index;
+    }
+
+    m_ChunkIndex[insert_index] = new_chunk;
+    ++m_NumChunks;
+
+    MemoryIndex chunk_id = 0u;
+
+    while (chunk_id != m_NumChunkIds && m_ChunkById[chunk_id] != nullptr)
+    {
+      ++chunk_id;
+    }
+
+    if (chunk_id == m_NumChunkIds)
+    {
+      ++m_NumChunkIds;
+    }
+
+    m_ChunkById[chunk_id] = new_chunk;
+    new_chunk->id         = chunk_id;
+
+    if (m_TrackChunks)
+    {
+      new_chunk->free_list  = nullptr;
+      new_chunk->num_live   = 0u;
+      new_chunk->num_bumped = 0u;
+
+      GrowingPool::ListPush(m_FreeChunks, new_chunk);
+      ++m_NumFreeChunks;
+    }
+    else
+    {
+      // Only called once every untouched chunk has been used up.
+      m_BumpCurrent        = chunk_bytes;
+      m_BumpEnd            = chunk_bytes + m_ChunkMemSize;
+      m_NextUntouchedChunk = m_NumChunks;
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+void Memory::GrowingPoolAllocator::ReleaseChunk(ChunkFooter* const chunk) noexcept
+{
+  GrowingPool::ListRemove(m_FreeChunks, chunk);
+  --m_NumFreeChunks;
+
+  MemoryIndex index = 0u;
+
+  while (m_ChunkIndex[index] != chunk)
+  {
+    ++index;
+  }
+
+  --m_NumChunks;
+
+  for (; index < m_NumChunks; ++index)
+  {
+    m_ChunkIndex[index] = m_ChunkIndex[index + 1u];
+  }
+
+  m_ChunkById[chunk->id] = nullptr;
+
+  while (m_NumChunkIds != 0u && m_ChunkById[m_NumChunkIds - 1u] == nullptr)
+  {
+    --m_NumChunkIds;
+  }
+
+  bfMemDeallocate(m_ParentAllocator, ChunkBgn(chunk), m_ChunkMemSize + sizeof(ChunkFooter), m_Alignment);
+}
+
+void Memory::GrowingPoolAllocator::TrimToSlack() noexcept
+{
+  while (m_NumFreeChunks > m_FreeChunkSlack)
+  {
+    ReleaseChunk(m_FreeChunks);
+  }
+}
+
+//-------------------------------------------------------------------------------------//
+// Growing Linear Allocator
+//-------------------------------------------------------------------------------------//
+
+Memory::GrowingLinearAllocator::GrowingLinearAllocator(
+ IPolymorphicAllocator& parent_allocator,
+ const MemoryIndex      initial_chunk_size,
+ const MemoryIndex      growth_factor) noexcept :
+  m_ParentAllocator{parent_allocator},
+  m_ChunkSize{initial_chunk_size},
+  m_GrowthFactor{growth_factor},
+  m_CurrentChunk{nullptr},
+  m_SpareChunk{nullptr},
+  m_Current{nullptr},
+  m_ChunkEnd{nullptr}
+{
+  bfMemAssert(initial_chunk_size > sizeof(ChunkHeader), "Chunk size must be greater than the chunk header size (%zu).", sizeof(ChunkHeader));
+  bfMemAssert(growth_factor > 0, "Growth factor must be greater than 0.");
+}
+
+void Memory::GrowingLinearAllocator::Clear() noexcept
+{
+  ChunkHeader* chunk = m_CurrentChunk;
+
+  while (chunk)
+  {
+    ChunkHeader* const prev_chunk = chunk->prev;
+
+    ReleaseChunk(chunk);
+
+    chunk = prev_chunk;
+  }
+
+  ChunkHeader* const kept_chunk = m_SpareChunk;
+
+  if (kept_chunk)
+  {
+    kept_chunk->prev = nullptr;
+  }
+
+  m_SpareChunk = nullptr;
+  SetCurrentChunk(kept_chunk);
+}
+
+AllocationResult Memory::GrowingLinearAllocator::Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+{
+  if (size != 0u)
+  {
+    if (m_Current)
+    {
+      void* const aligned_ptr     = AlignPointer(m_Current, alignment);
+      byte* const aligned_ptr_end = static_cast<byte*>(aligned_ptr) + size;
 
-    const PoolAllocatorSetupResult chunk_pool_setup = PoolAllocator::SetupPool(chunk_bytes, m_ChunkMemSize, m_BlockSize, m_Alignment);
+      if (aligned_ptr_end <= m_ChunkEnd)
+      {
+        m_Current = aligned_ptr_end;
+        return AllocationResult(aligned_ptr, size);
+      }
+    }
 
-    if (chunk_pool_setup.head)
+    if (GrowChunk(size, alignment, source_info))
     {
-      m_PoolHead = chunk_pool_setup.head;
-      goto pool_alloc;
+      void* const aligned_ptr = AlignPointer(m_Current, alignment);
+
+      m_Current = static_cast<byte*>(aligned_ptr) + size;
+      return AllocationResult(aligned_ptr, size);
     }
   }
 
   return AllocationResult::Null();
 }
 
-void Memory::GrowingPoolAllocator::Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
+void Memory::GrowingLinearAllocator::Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
 {
-  bfMemAssert(size <= m_BlockSize, "That allocation did not come from this allocator (bad size).");
-  bfMemAssert(alignment <= m_Alignment, "That allocation did not come from this allocator (bad alignment).");
+  (void)alignment;
 
-  PoolAllocatorBlock* const block = static_cast<PoolAllocatorBlock*>(ptr);
+  const byte* const ptr_end = static_cast<const byte*>(ptr) + size;
 
-  block->next = m_PoolHead;
-  m_PoolHead  = block;
+  if (ptr_end == m_Current)
+  {
+    m_Current = static_cast<byte*>(ptr);
+  }
+}
+
+void Memory::GrowingLinearAllocator::QueryStats(AllocatorStats& out_stats) const noexcept
+{
+  out_stats = {};
+
+  for (ChunkHeader* chunk = m_CurrentChunk; chunk; chunk = chunk->prev)
+  {
+    out_stats.total_bytes += chunk->size;
+    out_stats.overhead_bytes += sizeof(ChunkHeader);
+
+    if (chunk == m_CurrentChunk)
+    {
+      const byte* const aligned_current = static_cast<const byte*>(AlignPointer(m_Current, DefaultAlignment));
+
+      out_stats.used_bytes += m_Current - ChunkBgn(chunk);
+      out_stats.free_bytes += m_ChunkEnd - m_Current;
+      out_stats.num_free_blocks += m_ChunkEnd != m_Current ? 1u : 0u;
+      out_stats.largest_free_block = aligned_current < m_ChunkEnd ? MemoryIndex(m_ChunkEnd - aligned_current) : 0u;
+    }
+    else
+    {
+      out_stats.used_bytes += chunk->size - sizeof(ChunkHeader);
+    }
+  }
+
+  if (m_SpareChunk)
+  {
+    // Same bound `GrowChunk` checks before reusing the spare.
+    const MemoryIndex padding = sizeof(ChunkHeader) + DefaultAlignment - 1u;
+    const MemoryIndex largest = m_SpareChunk->size > padding ? m_SpareChunk->size - padding : 0u;
+
+    out_stats.total_bytes += m_SpareChunk->size;
+    out_stats.overhead_bytes += sizeof(ChunkHeader);
+    out_stats.free_bytes += m_SpareChunk->size - sizeof(ChunkHeader);
+    out_stats.num_free_blocks += 1u;
+    out_stats.largest_free_block = largest > out_stats.largest_free_block ? largest : out_stats.largest_free_block;
+  }
+}
+
+void Memory::GrowingLinearAllocator::FreeMemory() noexcept
+{
+  ChunkHeader* chunk = m_CurrentChunk;
+
+  while (chunk)
+  {
+    ChunkHeader* const prev_chunk = chunk->prev;
+
+    FreeChunk(chunk);
+
+    chunk = prev_chunk;
+  }
+
+  if (m_SpareChunk)
+  {
+    FreeChunk(m_SpareChunk);
+    m_SpareChunk = nullptr;
+  }
+
+  SetCurrentChunk(nullptr);
+}
+
+bool Memory::GrowingLinearAllocator::GrowChunk(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo& source_info) noexcept
+{
+  const MemoryIndex required_size = sizeof(ChunkHeader) + size + (alignment - 1u);
+  ChunkHeader*      new_chunk     = nullptr;
+
+  if (m_SpareChunk && m_SpareChunk->size >= required_size)
+  {
+    new_chunk    = m_SpareChunk;
+    m_SpareChunk = nullptr;
+  }
+  else
+  {
+    const bool             is_oversized = m_ChunkSize < required_size;
+    const MemoryIndex      chunk_size   = is_oversized ? required_size : m_ChunkSize;
+    const AllocationResult chunk_memory = (bfMemAllocate)(m_ParentAllocator, chunk_size, DefaultAlignment, source_info);
+
+    if (!chunk_memory)
+    {
+      return false;
+    }
+
+    new_chunk       = static_cast<ChunkHeader*>(chunk_memory.ptr);
+    new_chunk->size = chunk_memory.num_bytes;
+
+    if (!is_oversized && !WillMulOverflow(m_ChunkSize, m_GrowthFactor))
+    {
+      m_ChunkSize *= m_GrowthFactor;
+    }
+  }
+
+  new_chunk->prev = m_CurrentChunk;
+  SetCurrentChunk(new_chunk);
+
+  return true;
+}
+
+void Memory::GrowingLinearAllocator::SetCurrentChunk(ChunkHeader* const chunk) noexcept
+{
+  m_CurrentChunk = chunk;
+  m_Current      = chunk ? ChunkBgn(chunk) : nullptr;
+  m_ChunkEnd     = chunk ? ChunkEnd(chunk) : nullptr;
+}
+
+void Memory::GrowingLinearAllocator::FreeChunk(ChunkHeader* const chunk) noexcept
+{
+  bfMemDeallocate(m_ParentAllocator, chunk, chunk->size, DefaultAlignment);
+}
+
+void Memory::GrowingLinearAllocator::ReleaseChunk(ChunkHeader* const chunk) noexcept
+{
+  if (!m_SpareChunk || m_SpareChunk->size < chunk->size)
+  {
+    if (m_SpareChunk)
+    {
+      FreeChunk(m_SpareChunk);
+    }
+
+    m_SpareChunk = chunk;
+  }
+  else
+  {
+    FreeChunk(chunk);
+  }
+}
+
+void Memory::GrowingLinearAllocatorSavePoint::Save(GrowingLinearAllocator& allocator) noexcept
+{
+  m_Allocator    = &allocator;
+  m_RestoreChunk = allocator.m_CurrentChunk;
+  m_RestorePoint = allocator.m_Current;
+}
+
+void Memory::GrowingLinearAllocatorSavePoint::Restore() noexcept
+{
+  bfMemAssert(m_Allocator != nullptr, "Savepoint must be active before restore can be called.");
+
+  GrowingLinearAllocator& allocator = *m_Allocator;
+
+  while (allocator.m_CurrentChunk != m_RestoreChunk)
+  {
+    GrowingLinearAllocator::ChunkHeader* const chunk = allocator.m_CurrentChunk;
+
+    bfMemAssert(chunk != nullptr, "Savepoint chunk no longer belongs to the allocator, was it cleared?");
+
+    allocator.m_CurrentChunk = chunk->prev;
+    allocator.ReleaseChunk(chunk);
+  }
+
+  allocator.SetCurrentChunk(m_RestoreChunk);
+  allocator.m_Current = m_RestorePoint;
+  m_Allocator         = nullptr;
 }
@@ -0,0 +1,116 @@
+/******************************************************************************/
+/*!
+ * @file   lock_policies.cpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Lock policies to be used with `Allocator<>` for making any `BaseAllocator` thread-safe.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#include "memory/lock_policies.hpp"
+
+#include <thread>  // this_thread::yield
+
+#if defined(_MSC_VER)
+#include <intrin.h>  // _mm_pause, __yield
+#elif defined(__i386__) || defined(__x86_64__)
+#include <immintrin.h>  // _mm_pause
+#endif
+
+namespace LockPolicies
+{
+  static constexpr unsigned int MaxSpinCount     = 64u;  //!< Max number of `CpuRelax` between checks of the lock.
+  static constexpr unsigned int MaxSpinIteration = 16u;  //!< Number of backoff rounds before yielding the thread for each check.
+
+  struct SpinBackoff
+  {
+    unsigned int spin_count = 1u;
+    unsigned int iteration  = 0u;
+
+    void Wait() noexcept
+    {
+      if (iteration < MaxSpinIteration)
+      {
+        for (unsigned int i = 0u; i < spin_count; ++i)
+        {
+          Memory::CpuRelax();
+        }
+
+        spin_count = spin_count < MaxSpinCount ? spin_count * 2u : MaxSpinCount;
+        ++iteration;
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+  };
+}  // namespace LockPolicies
+
+void Memory::CpuRelax() noexcept
+{
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+  _mm_pause();
+#elif defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64))
+  __yield();
+#elif defined(__i386__) || defined(__x86_64__)
+  _mm_pause();
+#elif defined(__arm__) || defined(__aarch64__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+void Memory::SpinLock::LockSlow() noexcept
+{
+  RecordContention();
+
+  LockPolicies::SpinBackoff backoff = {};
+
+  do
+  {
+    // Spin on a plain load so waiters do not keep stealing the cache line from the owner.
+    while (m_IsLocked.load(std::memory_order_relaxed))
+    {
+      backoff.Wait();
+    }
+  } while (m_IsLocked.exchange(true, std::memory_order_acquire));
+}
+
+void Memory::TicketLock::LockSlow(const std::uint32_t ticket) noexcept
+{
+  RecordContention();
+
+  LockPolicies::SpinBackoff backoff = {};
+
+  while (m_NowServing.load(std::memory_order_acquire) != ticket)
+  {
+    backoff.Wait();
+  }
+}
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
@@ -1,7 +1,16 @@
 #include "memory/memory_api.hpp"
 
+#include <cstdint>  // uint64_t
 #include <cstring>  // memset, memcpy
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>  // _mm_set1_epi8, _mm_loadu_si128, _mm_cmpeq_epi8, _mm_and_si128, _mm_movemask_epi8
+#define BF_MEMORY_PATTERN_SSE2 1
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>  // vdupq_n_u8, vld1q_u8, vceqq_u8, vandq_u8, vminvq_u8, vpmin_u8, vget_low_u8, vget_high_u8, vget_lane_u8
+#define BF_MEMORY_PATTERN_NEON 1
+#endif
+
 void bfMemCopy(void* const dst, const void* const src, std::size_t num_bytes)
 {
   std::memcpy(dst, src, num_bytes);
@@ -11,3 +20,76 @@ void bfMemSet(void* const dst, const unsigned char value, std::size_t num_bytes)
 {
   std::memset(dst, value, num_bytes);
 }
+
+void Memory::FillBytePattern(byte* const bytes, const MemoryIndex num_bytes, const byte pattern) noexcept
+{
+  std::memset(bytes, pattern, num_bytes);
+}
+
+bool Memory::IsBytePattern(const byte* const bytes, const MemoryIndex num_bytes, const byte pattern) noexcept
+{
+  const byte* current = bytes;
+  const byte* end     = bytes + num_bytes;
+
+#if BF_MEMORY_PATTERN_SSE2
+  if (MemoryIndex(end - current) >= 16u)
+  {
+    const __m128i wide_pattern = _mm_set1_epi8(char(pattern));
+    __m128i       all_equal    = _mm_set1_epi8(char(0xFF));
+
+    // The last vector may overlap bytes already checked rather than dropping to the byte loop.
+    for (; MemoryIndex(end - current) > 16u; current += 16u)
+    {
+      all_equal = _mm_and_si128(all_equal, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(current)), wide_pattern));
+    }
+
+    all_equal = _mm_and_si128(all_equal, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(end - 16u)), wide_pattern));
+
+    return _mm_movemask_epi8(all_equal) == 0xFFFF;
+  }
+#elif BF_MEMORY_PATTERN_NEON
+  if (MemoryIndex(end - current) >= 16u)
+  {
+    const uint8x16_t wide_pattern = vdupq_n_u8(pattern);
+    uint8x16_t       all_equal    = vdupq_n_u8(0xFF);
+
+    // The last vector may overlap bytes already checked rather than dropping to the byte loop.
+    for (; MemoryIndex(end - current) > 16u; current += 16u)
+    {
+      all_equal = vandq_u8(all_equal, vceqq_u8(vld1q_u8(current), wide_pattern));
+    }
+
+    all_equal = vandq_u8(all_equal, vceqq_u8(vld1q_u8(end - 16u), wide_pattern));
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return vminvq_u8(all_equal) == 0xFF;
+#else
+    // ARMv7 NEON has no across vector minimum, fold pairwise down to a single lane instead.
+    uint8x8_t min_lanes = vpmin_u8(vget_low_u8(all_equal), vget_high_u8(all_equal));
+    min_lanes           = vpmin_u8(min_lanes, min_lanes);
+    min_lanes           = vpmin_u8(min_lanes, min_lanes);
+    min_lanes           = vpmin_u8(min_lanes, min_lanes);
+
+    return vget_lane_u8(min_lanes, 0) == 0xFF;
+#endif
+  }
+#endif
+
+  const std::uint64_t wide_pattern = std::uint64_t(pattern) * 0x0101010101010101u;
+  std::uint64_t       difference   = 0u;
+
+  for (; MemoryIndex(end - current) >= sizeof(std::uint64_t); current += sizeof(std::uint64_t))
+  {
+    std::uint64_t word;
+    std::memcpy(&word, current, sizeof(word));
+
+    difference |= word ^ wide_pattern;
+  }
+
+  for (; current != end; ++current)
+  {
+    difference |= *current ^ pattern;
+  }
+
+  return difference == 0u;
+}
@@ -0,0 +1,262 @@
+/******************************************************************************/
+/*!
+ * @file   numa_heap.cpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Page granular heaps that place their memory on a specific NUMA node,
+ *   meant to be the parent allocator of pools and arenas so their chunks
+ *   are local to the threads using them.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#include "memory/numa_heap.hpp"
+
+#include "memory/alignment.hpp"       // AlignSize
+#include "memory/virtual_memory.hpp"  // VirtualMemoryPageSize, VirtualMemoryRelease
+
+#include <new>  // placement new
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>  // GetNumaHighestNodeNumber, GetCurrentProcessorNumberEx, GetNumaProcessorNodeEx, VirtualAllocExNuma
+#else
+#include <sys/mman.h>  // mmap
+#if defined(__linux__)
+#include <sys/syscall.h>  // SYS_mbind, SYS_getcpu
+#include <unistd.h>       // syscall
+
+#include <cstdio>  // fopen, fgetc, fclose
+#endif
+#endif
+
+//-------------------------------------------------------------------------------------//
+// NUMA Primitives
+//-------------------------------------------------------------------------------------//
+
+namespace Numa
+{
+#if defined(__linux__)
+  static constexpr int         MPOL_PREFERRED_MODE = 1;  //!< `MPOL_PREFERRED` from <linux/mempolicy.h>, allocate from the node unless it is full.
+  static constexpr MemoryIndex NodeMaskBits        = sizeof(unsigned long) * 8u;
+  static constexpr MemoryIndex NodeMaskLength      = (BF_MEMORY_MAX_NUMA_NODES + NodeMaskBits - 1u) / NodeMaskBits;
+
+  // Parses a node list such as "0", "0-3" or "0,2-3" where the last number is the highest node.
+  static MemoryIndex HighestOnlineNode() noexcept
+  {
+    std::FILE* const file = std::fopen("/sys/devices/system/node/online", "r");
+
+    if (!file)
+    {
+      return 0u;
+    }
+
+    MemoryIndex highest_node = 0u;
+    MemoryIndex current_node = 0u;
+
+    for (int c = std::fgetc(file); c != EOF; c = std::fgetc(file))
+    {
+      if ('0' <= c && c <= '9')
+      {
+        current_node = current_node * 10u + MemoryIndex(c - '0');
+      }
+      else
+      {
+        highest_node = current_node > highest_node ? current_node : highest_node;
+        current_node = 0u;
+      }
+    }
+
+    std::fclose(file);
+
+    return current_node > highest_node ? current_node : highest_node;
+  }
+#endif
+}  // namespace Numa
+
+MemoryIndex Memory::NumaNodeCount() noexcept
+{
+  static const MemoryIndex s_NodeCount = []() -> MemoryIndex {
+#if defined(_WIN32)
+    ULONG             highest_node = 0u;
+    const MemoryIndex node_count   = GetNumaHighestNodeNumber(&highest_node) ? MemoryIndex(highest_node) + 1u : 1u;
+#elif defined(__linux__)
+    const MemoryIndex node_count = Numa::HighestOnlineNode() + 1u;
+#else
+    const MemoryIndex node_count = 1u;
+#endif
+
+    return node_count < BF_MEMORY_MAX_NUMA_NODES ? node_count : BF_MEMORY_MAX_NUMA_NODES;
+  }();
+
+  return s_NodeCount;
+}
+
+MemoryIndex Memory::NumaCurrentNode() noexcept
+{
+  MemoryIndex node = 0u;
+
+  if (NumaNodeCount() > 1u)
+  {
+#if defined(_WIN32)
+    PROCESSOR_NUMBER processor;
+    USHORT           processor_node;
+
+    GetCurrentProcessorNumberEx(&processor);
+
+    if (GetNumaProcessorNodeEx(&processor, &processor_node))
+    {
+      node = MemoryIndex(processor_node);
+    }
+#elif defined(__linux__)
+    unsigned int cpu;
+    unsigned int cpu_node;
+
+    if (syscall(SYS_getcpu, &cpu, &cpu_node, nullptr) == 0)
+    {
+      node = MemoryIndex(cpu_node);
+    }
+#endif
+  }
+
+  return node < NumaNodeCount() ? node : 0u;
+}
+
+void* Memory::NumaMemoryAllocate(const MemoryIndex size, const MemoryIndex node) noexcept
+{
+  const bool is_valid_node = node < NumaNodeCount();
+
+#if defined(_WIN32)
+  return VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, is_valid_node ? DWORD(node) : NUMA_NO_PREFERRED_NODE);
+#else
+  void* const ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+  if (ptr == MAP_FAILED)
+  {
+    return nullptr;
+  }
+
+#if defined(__linux__)
+  // The pages have not been touched yet so binding now decides where they fault in,
+  // a failure here just means the default placement which is still usable memory.
+  if (is_valid_node && NumaNodeCount() > 1u)
+  {
+    unsigned long node_mask[Numa::NodeMaskLength] = {};
+    node_mask[node / Numa::NodeMaskBits]          = 1ul << (node % Numa::NodeMaskBits);
+
+    // The kernel reads `maxnode - 1` bits from the mask.
+    syscall(SYS_mbind, ptr, size, Numa::MPOL_PREFERRED_MODE, node_mask, Numa::NodeMaskLength * Numa::NodeMaskBits + 1u, 0u);
+  }
+#else
+  (void)is_valid_node;
+#endif
+
+  return ptr;
+#endif
+}
+
+//-------------------------------------------------------------------------------------//
+// NUMA Node Allocator
+//-------------------------------------------------------------------------------------//
+
+Memory::NumaNodeAllocator::NumaNodeAllocator(const MemoryIndex node) noexcept :
+  m_Node{node}
+{
+}
+
+AllocationResult Memory::NumaNodeAllocator::Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo&) const noexcept
+{
+  const MemoryIndex page_size = VirtualMemoryPageSize();
+
+  if (size != 0u && alignment <= page_size)
+  {
+    const MemoryIndex allocation_size = AlignSize(size, page_size);
+    void* const       ptr             = NumaMemoryAllocate(allocation_size, m_Node == CurrentNode ? NumaCurrentNode() : m_Node);
+
+    if (ptr)
+    {
+      return AllocationResult(ptr, allocation_size);
+    }
+  }
+
+  return AllocationResult::Null();
+}
+
+void Memory::NumaNodeAllocator::Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) const noexcept
+{
+  (void)alignment;
+
+  if (ptr)
+  {
+    VirtualMemoryRelease(ptr, AlignSize(size, VirtualMemoryPageSize()));
+  }
+}
+
+//-------------------------------------------------------------------------------------//
+// NUMA Heaps
+//-------------------------------------------------------------------------------------//
+
+namespace Numa
+{
+  // No marking or guards, any header would push chunk sized requests over a page boundary.
+  using NodeHeap = Allocator<Memory::NumaNodeAllocator, AllocationMarkPolicy::UNMARKED, BoundCheckingPolicy::UNCHECKED, Memory::NoMemoryTracking, Memory::NoLock>;
+}  // namespace Numa
+
+IPolymorphicAllocator& Memory::NumaNodeHeap(const MemoryIndex node) noexcept
+{
+  bfMemAssert(node < BF_MEMORY_MAX_NUMA_NODES, "Node is out of range of BF_MEMORY_MAX_NUMA_NODES.");
+
+  // The heaps are intentionally never destroyed so that memory freed during static destruction is still valid.
+  alignas(Numa::NodeHeap) static byte s_NodeHeapStorage[sizeof(Numa::NodeHeap) * BF_MEMORY_MAX_NUMA_NODES];
+  static Numa::NodeHeap* const s_NodeHeaps = []() {
+    Numa::NodeHeap* const node_heaps = reinterpret_cast<Numa::NodeHeap*>(s_NodeHeapStorage);
+
+    for (MemoryIndex node_index = 0u; node_index < BF_MEMORY_MAX_NUMA_NODES; ++node_index)
+    {
+      new (node_heaps + node_index) Numa::NodeHeap(node_index);
+    }
+
+    return node_heaps;
+  }();
+
+  return s_NodeHeaps[node];
+}
+
+IPolymorphicAllocator& Memory::NumaLocalHeap() noexcept
+{
+  static Numa::NodeHeap s_LocalHeap{NumaNodeAllocator::CurrentNode};
+
+  return s_LocalHeap;
+}
+
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
@@ -0,0 +1,621 @@
+/******************************************************************************/
+/*!
+ * @file   tracking_policies.cpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Allocation tracking policies to be used with `Allocator<>` for
+ *   finding out where and how memory is being used.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#include "memory/tracking_policies.hpp"
+
+#include <atomic>   // atomic
+#include <chrono>   // steady_clock
+#include <cmath>    // log, exp
+#include <cstdint>  // uintptr_t
+#include <cstring>  // memcpy, strlen, strcpy
+#include <mutex>    // mutex, lock_guard
+#include <thread>   // this_thread::yield, this_thread::get_id
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>  // CaptureStackBackTrace, CreateFileMappingA, MapViewOfFile, GetCurrentThreadId
+#define BF_MEMORY_HAS_BACKTRACE 1
+#else
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, munmap
+#include <unistd.h>    // ftruncate, close
+#if defined(__linux__)
+#include <sys/syscall.h>  // SYS_gettid
+#endif
+#if defined(__GLIBC__) || defined(__APPLE__)
+#include <execinfo.h>  // backtrace
+#define BF_MEMORY_HAS_BACKTRACE 1
+#else
+#define BF_MEMORY_HAS_BACKTRACE 0
+#endif
+#endif
+
+//-------------------------------------------------------------------------------------//
+// Statistics Tracking
+//-------------------------------------------------------------------------------------//
+
+MemoryIndex Memory::MemoryStatisticsSizeBucket(const MemoryIndex size) noexcept
+{
+  MemoryIndex bucket    = 0u;
+  MemoryIndex remaining = size;
+
+  while (remaining != 0u && bucket < MemoryStatistics::NumSizeBuckets - 1u)
+  {
+    remaining >>= 1u;
+    ++bucket;
+  }
+
+  return bucket;
+}
+
+MemoryIndex Memory::MemoryCallSiteHash(const AllocationSourceInfo& source_info) noexcept
+{
+#if BF_MEMORY_ALLOCATION_INFO
+  // 64bit FNV-1a over the pointer values.
+  const std::uint64_t values[] = {
+   std::uint64_t(reinterpret_cast<std::uintptr_t>(source_info.file)),
+   std::uint64_t(reinterpret_cast<std::uintptr_t>(source_info.function)),
+   std::uint64_t(source_info.line),
+  };
+
+  std::uint64_t hash = 0xCBF29CE484222325ull;
+
+  for (const std::uint64_t value : values)
+  {
+    for (unsigned int byte_index = 0u; byte_index < sizeof(value); ++byte_index)
+    {
+      hash ^= (value >> (byte_index * 8u)) & 0xFFu;
+      hash *= 0x100000001B3ull;
+    }
+  }
+
+  return MemoryIndex(hash ^ (hash >> 32u));
+#else
+  (void)source_info;
+  return 0u;
+#endif
+}
+
+bool Memory::MemoryIsSameCallSite(const AllocationSourceInfo& lhs, const AllocationSourceInfo& rhs) noexcept
+{
+#if BF_MEMORY_ALLOCATION_INFO
+  return lhs.file == rhs.file && lhs.function == rhs.function && lhs.line == rhs.line;
+#else
+  (void)lhs;
+  (void)rhs;
+  return true;
+#endif
+}
+
+
+//-------------------------------------------------------------------------------------//
+// Sampling Tracking
+//-------------------------------------------------------------------------------------//
+
+namespace Sampling
+{
+  static constexpr MemoryIndex MaxCapturedFrames = 64u;
+  static constexpr MemoryIndex NumSkippedFrames  = 1u;  //!< Skips `MemoryCaptureBacktrace` itself.
+
+  static std::uint64_t NextRandom(std::uint64_t* const state) noexcept
+  {
+    // xorshift64*
+    std::uint64_t x = *state;
+    x ^= x >> 12u;
+    x ^= x << 25u;
+    x ^= x >> 27u;
+    *state = x;
+    return x * 0x2545F4914F6CDD1Dull;
+  }
+
+  // Expected number of real allocations of `size` bytes that a single sample stands for.
+  static double SampleScale(const MemoryIndex size, const MemoryIndex sample_interval) noexcept
+  {
+    if (sample_interval == 0u || size == 0u)
+    {
+      return 1.0;
+    }
+
+    return 1.0 / (1.0 - std::exp(-double(size) / double(sample_interval)));
+  }
+
+  static void WriteMappedLibraries(std::FILE* const file) noexcept
+  {
+#if defined(__linux__)
+    std::FILE* const maps = std::fopen("/proc/self/maps", "r");
+
+    if (maps)
+    {
+      char        buffer[4096];
+      std::size_t num_read;
+
+      while ((num_read = std::fread(buffer, 1u, sizeof(buffer), maps)) != 0u)
+      {
+        std::fwrite(buffer, 1u, num_read, file);
+      }
+
+      std::fclose(maps);
+    }
+#else
+    (void)file;
+#endif
+  }
+}  // namespace Sampling
+
+MemoryIndex Memory::MemoryCaptureBacktrace(void** const out_frames, const MemoryIndex max_frames) noexcept
+{
+#if BF_MEMORY_HAS_BACKTRACE
+  void*             frames[Sampling::MaxCapturedFrames];
+  const MemoryIndex num_wanted = (max_frames + Sampling::NumSkippedFrames) < Sampling::MaxCapturedFrames ? (max_frames + Sampling::NumSkippedFrames) : Sampling::MaxCapturedFrames;
+
+#if defined(_WIN32)
+  const MemoryIndex num_captured = MemoryIndex(CaptureStackBackTrace(0u, DWORD(num_wanted), frames, nullptr));
+#else
+  const MemoryIndex num_captured = MemoryIndex(backtrace(frames, int(num_wanted)));
+#endif
+
+  MemoryIndex num_written = 0u;
+
+  for (MemoryIndex index = Sampling::NumSkippedFrames; index < num_captured && num_written < max_frames; ++index)
+  {
+    out_frames[num_written++] = frames[index];
+  }
+
+  return num_written;
+#else
+  (void)out_frames;
+  (void)max_frames;
+  return 0u;
+#endif
+}
+
+std::int64_t Memory::MemorySamplingNextInterval(std::uint64_t* const rng_state, const MemoryIndex mean_interval) noexcept
+{
+  // Uniform in (0, 1], 53 bits of the random number to fill a double's mantissa.
+  const double uniform = (double(Sampling::NextRandom(rng_state) >> 11u) + 1.0) * (1.0 / 9007199254740992.0);
+
+  return std::int64_t(-std::log(uniform) * double(mean_interval)) + 1;
+}
+
+void Memory::MemoryHeapProfileWriteHeader(std::FILE* const file, const HeapProfileFormat format, const MemoryHeapProfileTotals& totals, const MemoryIndex sample_interval) noexcept
+{
+  if (format == HeapProfileFormat::PPROF)
+  {
+    std::fprintf(file, "heap profile: %zu: %zu [ %zu: %zu] @ heap_v2/%zu\n", totals.num_samples, totals.num_sampled_bytes, totals.num_samples, totals.num_sampled_bytes, sample_interval);
+  }
+  else
+  {
+    std::fprintf(file, "Heap Profile: %zu live samples (%zu bytes sampled), sample interval %zu bytes\n", totals.num_samples, totals.num_sampled_bytes, sample_interval);
+  }
+}
+
+void Memory::MemoryHeapProfileWriteSample(std::FILE* const file, const HeapProfileFormat format, const MemorySampleView& sample, const MemoryIndex sample_interval) noexcept
+{
+  if (format == HeapProfileFormat::PPROF)
+  {
+    // pprof does the unsampling itself given the interval in the header.
+    std::fprintf(file, "%6d: %8zu [%6d: %8zu] @", 1, sample.size, 1, sample.size);
+
+    for (MemoryIndex index = 0u; index < sample.num_frames; ++index)
+    {
+      std::fprintf(file, " %p", sample.frames[index]);
+    }
+
+    std::fprintf(file, "\n");
+  }
+  else
+  {
+    const double scale = Sampling::SampleScale(sample.size, sample_interval);
+
+    std::fprintf(file, "  ~%.1f allocations, ~%.0f bytes (sampled size %zu)", scale, scale * double(sample.size), sample.size);
+
+#if BF_MEMORY_ALLOCATION_INFO
+    std::fprintf(file, " @ %s:%d (%s)", sample.source_info->file, sample.source_info->line, sample.source_info->function);
+#endif
+
+    std::fprintf(file, "\n");
+
+    for (MemoryIndex index = 0u; index < sample.num_frames; ++index)
+    {
+      std::fprintf(file, "      #%zu %p\n", index, sample.frames[index]);
+    }
+  }
+}
+
+void Memory::MemoryHeapProfileWriteFooter(std::FILE* const file, const HeapProfileFormat format) noexcept
+{
+  if (format == HeapProfileFormat::PPROF)
+  {
+    std::fprintf(file, "\nMAPPED_LIBRARIES:\n");
+    Sampling::WriteMappedLibraries(file);
+  }
+
+  std::fflush(file);
+}
+
+//-------------------------------------------------------------------------------------//
+// Trace Tracking
+//-------------------------------------------------------------------------------------//
+
+namespace Trace
+{
+  static_assert(BF_MEMORY_TRACE_MAX_CALL_SITES > 0 && BF_MEMORY_TRACE_MAX_CALL_SITES < 65536 && (BF_MEMORY_TRACE_MAX_CALL_SITES & (BF_MEMORY_TRACE_MAX_CALL_SITES - 1)) == 0, "BF_MEMORY_TRACE_MAX_CALL_SITES must be a power of two below 65536.");
+
+  static constexpr MemoryIndex MaxPathLength = 512u;
+
+  enum CallSiteState : std::uint32_t
+  {
+    CALL_SITE_EMPTY   = 0u,
+    CALL_SITE_WRITING = 1u,
+    CALL_SITE_READY   = 2u,
+  };
+
+  struct CallSiteSlot
+  {
+    std::atomic<std::uint32_t> state;
+    AllocationSourceInfo       source_info;  //!< Only read once `state` is `CALL_SITE_READY`.
+  };
+
+  struct Session
+  {
+    std::mutex                 lock;                        //!< Guards everything but the atomics.
+    std::atomic<bool>          is_active;                   //!<
+    std::atomic<std::uint64_t> generation;                  //!< Bumped on each start so threads know their trace file is from an old trace.
+    std::atomic<std::uint32_t> next_allocator_id;           //!<
+    std::atomic<std::uint64_t> start_time;                  //!< Only written while no trace is active.
+    char                       path_prefix[MaxPathLength];  //!<
+    MemoryIndex                records_per_thread;          //!<
+    std::uint32_t              next_thread_index;           //!<
+  };
+
+  static Session s_Session = {};
+
+#if BF_MEMORY_ALLOCATION_INFO
+  static CallSiteSlot s_CallSites[BF_MEMORY_TRACE_MAX_CALL_SITES] = {};
+#endif
+
+  static std::uint64_t Now() noexcept
+  {
+    return std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+  }
+
+  static std::uint64_t CurrentThreadId() noexcept
+  {
+#if defined(_WIN32)
+    return std::uint64_t(GetCurrentThreadId());
+#elif defined(__linux__)
+    return std::uint64_t(syscall(SYS_gettid));
+#else
+    return std::uint64_t(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+#endif
+  }
+
+  static std::uint8_t Log2(MemoryIndex value) noexcept
+  {
+    std::uint8_t result = 0u;
+
+    while (value > 1u)
+    {
+      value >>= 1u;
+      ++result;
+    }
+
+    return result;
+  }
+
+  // Maps a shared read / write view of a newly created file of `size` bytes.
+  static void* MapNewFile(const char* const path, const MemoryIndex size) noexcept
+  {
+#if defined(_WIN32)
+    const HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+      return nullptr;
+    }
+
+    const std::uint64_t size64  = std::uint64_t(size);
+    const HANDLE        mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, DWORD(size64 >> 32u), DWORD(size64), nullptr);
+    void* const         view    = mapping ? MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0u, 0u, size) : nullptr;
+
+    // The view keeps the mapping and file alive.
+    if (mapping)
+    {
+      CloseHandle(mapping);
+    }
+    CloseHandle(file);
+
+    return view;
+#else
+    const int file = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    if (file < 0)
+    {
+      return nullptr;
+    }
+
+    void* view = nullptr;
+
+    if (ftruncate(file, off_t(size)) == 0)
+    {
+      view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+      view = view != MAP_FAILED ? view : nullptr;
+    }
+
+    // The mapping keeps the file alive.
+    close(file);
+
+    return view;
+#endif
+  }
+
+  static void UnmapFile(void* const view, const MemoryIndex size) noexcept
+  {
+#if defined(_WIN32)
+    (void)size;
+    UnmapViewOfFile(view);
+#else
+    munmap(view, size);
+#endif
+  }
+
+  //
+  // Only ever touched by its own thread so records are written without any synchronization.
+  //
+  struct ThreadRing
+  {
+    Memory::MemoryTraceFileHeader* header     = nullptr;
+    Memory::MemoryTraceRecord*     records    = nullptr;
+    std::uint64_t          capacity   = 0u;
+    std::uint64_t          generation = 0u;  //!< 0 before the thread has seen any trace.
+    MemoryIndex            file_size  = 0u;
+
+    // Returns false if the trace file could not be made, `generation` is still updated so it is not retried for this trace.
+    bool Open(const std::uint64_t current_generation) noexcept
+    {
+      Close();
+      generation = current_generation;
+
+      char        path[MaxPathLength + 32u];
+      MemoryIndex num_records;
+      {
+        std::lock_guard<std::mutex> guard{s_Session.lock};
+
+        if (!s_Session.is_active.load(std::memory_order_relaxed) || s_Session.generation.load(std::memory_order_relaxed) != current_generation)
+        {
+          return false;
+        }
+
+        std::snprintf(path, sizeof(path), "%s.%u.bftrace", s_Session.path_prefix, unsigned(s_Session.next_thread_index++));
+        num_records = s_Session.records_per_thread;
+      }
+
+      const MemoryIndex size = sizeof(Memory::MemoryTraceFileHeader) + num_records * sizeof(Memory::MemoryTraceRecord);
+      void* const       view = MapNewFile(path, size);
+
+      if (!view)
+      {
+        return false;
+      }
+
+      header  = static_cast<Memory::MemoryTraceFileHeader*>(view);
+      records = reinterpret_cast<Memory::MemoryTraceRecord*>(header + 1);
+
+      std::memcpy(header->magic, "BFTRACE", sizeof(header->magic));
+      header->version     = Memory::MemoryTraceFileVersion;
+      header->record_size = sizeof(Memory::MemoryTraceRecord);
+      header->thread_id   = CurrentThreadId();
+      header->capacity    = num_records;
+      header->num_written = 0u;
+
+      capacity  = num_records;
+      file_size = size;
+
+      return true;
+    }
+
+    void Close() noexcept
+    {
+      if (header)
+      {
+        UnmapFile(header, file_size);
+        header  = nullptr;
+        records = nullptr;
+      }
+    }
+
+    ~ThreadRing() { Close(); }
+  };
+
+  static thread_local ThreadRing t_Ring = {};
+}  // namespace Trace
+
+bool Memory::MemoryTraceStart(const char* const path_prefix, const MemoryIndex records_per_thread) noexcept
+{
+  std::lock_guard<std::mutex> guard{Trace::s_Session.lock};
+
+  if (Trace::s_Session.is_active.load(std::memory_order_relaxed) || records_per_thread == 0u || std::strlen(path_prefix) >= Trace::MaxPathLength)
+  {
+    return false;
+  }
+
+  std::strcpy(Trace::s_Session.path_prefix, path_prefix);
+  Trace::s_Session.records_per_thread = records_per_thread;
+  Trace::s_Session.next_thread_index  = 0u;
+  Trace::s_Session.start_time.store(Trace::Now(), std::memory_order_relaxed);
+  Trace::s_Session.generation.fetch_add(1u, std::memory_order_release);
+  Trace::s_Session.is_active.store(true, std::memory_order_release);
+
+  return true;
+}
+
+void Memory::MemoryTraceStop() noexcept
+{
+  std::lock_guard<std::mutex> guard{Trace::s_Session.lock};
+
+  if (!Trace::s_Session.is_active.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+
+  Trace::s_Session.is_active.store(false, std::memory_order_release);
+
+  char path[Trace::MaxPathLength + 32u];
+  std::snprintf(path, sizeof(path), "%s.sites", Trace::s_Session.path_prefix);
+
+  std::FILE* const file = std::fopen(path, "w");
+
+  if (file)
+  {
+#if BF_MEMORY_ALLOCATION_INFO
+    for (MemoryIndex index = 0u; index < BF_MEMORY_TRACE_MAX_CALL_SITES; ++index)
+    {
+      const Trace::CallSiteSlot& slot = Trace::s_CallSites[index];
+
+      if (slot.state.load(std::memory_order_acquire) == Trace::CALL_SITE_READY)
+      {
+        std::fprintf(file, "%zu\t%d\t%s\t%s\n", index + 1u, slot.source_info.line, slot.source_info.file, slot.source_info.function);
+      }
+    }
+#endif
+
+    std::fclose(file);
+  }
+}
+
+bool Memory::MemoryTraceIsActive() noexcept
+{
+  return Trace::s_Session.is_active.load(std::memory_order_relaxed);
+}
+
+std::uint16_t Memory::MemoryTraceNewAllocatorId() noexcept
+{
+  return std::uint16_t(Trace::s_Session.next_allocator_id.fetch_add(1u, std::memory_order_relaxed));
+}
+
+std::uint16_t Memory::MemoryTraceInternCallSite(const AllocationSourceInfo& source_info) noexcept
+{
+#if BF_MEMORY_ALLOCATION_INFO
+  constexpr MemoryIndex mask  = BF_MEMORY_TRACE_MAX_CALL_SITES - 1u;
+  MemoryIndex           index = MemoryCallSiteHash(source_info) & mask;
+
+  for (MemoryIndex probe = 0u; probe < BF_MEMORY_TRACE_MAX_CALL_SITES;)
+  {
+    Trace::CallSiteSlot& slot  = Trace::s_CallSites[index];
+    std::uint32_t        state = slot.state.load(std::memory_order_acquire);
+
+    if (state == Trace::CALL_SITE_EMPTY)
+    {
+      if (slot.state.compare_exchange_strong(state, Trace::CALL_SITE_WRITING, std::memory_order_acquire, std::memory_order_acquire))
+      {
+        slot.source_info = source_info;
+        slot.state.store(Trace::CALL_SITE_READY, std::memory_order_release);
+
+        return std::uint16_t(index + 1u);
+      }
+
+      // Lost the race, look at what the other thread put in this slot.
+      continue;
+    }
+
+    if (state == Trace::CALL_SITE_WRITING)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+
+    if (MemoryIsSameCallSite(slot.source_info, source_info))
+    {
+      return std::uint16_t(index + 1u);
+    }
+
+    index = (index + 1u) & mask;
+    ++probe;
+  }
+#else
+  (void)source_info;
+#endif
+
+  return 0u;
+}
+
+void Memory::MemoryTraceWrite(const MemoryTraceOp op, const std::uint16_t allocator_id, const void* const ptr, const MemoryIndex size, const MemoryIndex alignment, const std::uint16_t call_site) noexcept
+{
+  Trace::ThreadRing& ring = Trace::t_Ring;
+
+  if (!Trace::s_Session.is_active.load(std::memory_order_acquire))
+  {
+    // The trace was stopped since this thread last wrote to it, give back the file's mapping.
+    if (ring.header)
+    {
+      ring.Close();
+    }
+
+    return;
+  }
+
+  const std::uint64_t generation = Trace::s_Session.generation.load(std::memory_order_acquire);
+
+  if (ring.generation != generation && !ring.Open(generation))
+  {
+    return;
+  }
+
+  if (!ring.records)
+  {
+    return;
+  }
+
+  const std::uint64_t num_written = ring.header->num_written;
+  MemoryTraceRecord&  record      = ring.records[num_written % ring.capacity];
+
+  record.timestamp      = Trace::Now() - Trace::s_Session.start_time.load(std::memory_order_relaxed);
+  record.address        = std::uint64_t(reinterpret_cast<std::uintptr_t>(ptr));
+  record.size           = std::uint64_t(size);
+  record.call_site      = call_site;
+  record.allocator_id   = allocator_id;
+  record.op             = op;
+  record.log2_alignment = Trace::Log2(alignment);
+  record.reserved       = 0u;
+
+  ring.header->num_written = num_written + 1u;
+}
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
@@ -0,0 +1,450 @@
+/******************************************************************************/
+/*!
+ * @file   virtual_memory.cpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Operating system virtual memory primitives and allocators built on
+ *   reserving address space up front and committing pages on demand.
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#include "memory/virtual_memory.hpp"
+
+#include "memory/alignment.hpp"  // AlignPointer, AlignSize
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>  // VirtualAlloc, VirtualFree, GetSystemInfo, GetLargePageMinimum
+#else
+#include <sys/mman.h>  // mmap, munmap, mprotect, madvise
+#include <unistd.h>    // sysconf
+#endif
+
+//-------------------------------------------------------------------------------------//
+// Virtual Memory Primitives
+//-------------------------------------------------------------------------------------//
+
+MemoryIndex Memory::VirtualMemoryPageSize() noexcept
+{
+  static const MemoryIndex s_PageSize = []() -> MemoryIndex {
+#if defined(_WIN32)
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    return MemoryIndex(system_info.dwPageSize);
+#else
+    const long page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? MemoryIndex(page_size) : MemoryIndex(4096u);
+#endif
+  }();
+
+  return s_PageSize;
+}
+
+void* Memory::VirtualMemoryReserve(const MemoryIndex size) noexcept
+{
+#if defined(_WIN32)
+  return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+  void* const ptr = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  return ptr != MAP_FAILED ? ptr : nullptr;
+#endif
+}
+
+bool Memory::VirtualMemoryCommit(void* const ptr, const MemoryIndex size) noexcept
+{
+  bfMemAssert(IsPointerAligned(ptr, VirtualMemoryPageSize()), "Commit range must be page aligned.");
+
+#if defined(_WIN32)
+  return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+  return mprotect(ptr, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+void Memory::VirtualMemoryDecommit(void* const ptr, const MemoryIndex size) noexcept
+{
+  bfMemAssert(IsPointerAligned(ptr, VirtualMemoryPageSize()), "Decommit range must be page aligned.");
+
+#if defined(_WIN32)
+  VirtualFree(ptr, size, MEM_DECOMMIT);
+#else
+  madvise(ptr, size, MADV_DONTNEED);
+  mprotect(ptr, size, PROT_NONE);
+#endif
+}
+
+void Memory::VirtualMemoryRelease(void* const ptr, const MemoryIndex size) noexcept
+{
+#if defined(_WIN32)
+  (void)size;
+  VirtualFree(ptr, 0u, MEM_RELEASE);
+#else
+  munmap(ptr, size);
+#endif
+}
+
+//-------------------------------------------------------------------------------------//
+// Huge Pages
+//-------------------------------------------------------------------------------------//
+
+namespace HugePage
+{
+#if !defined(_WIN32)
+  // Maps `size` bytes starting at a multiple of `alignment` by over mapping then unmapping the unaligned ends.
+  static void* MapAligned(const MemoryIndex size, const MemoryIndex alignment) noexcept
+  {
+    const MemoryIndex mapped_size = size + alignment - Memory::VirtualMemoryPageSize();
+    void* const       mapping     = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (mapping == MAP_FAILED)
+    {
+      return nullptr;
+    }
+
+    byte* const mapping_bgn = static_cast<byte*>(mapping);
+    byte* const mapping_end = mapping_bgn + mapped_size;
+    byte* const aligned_bgn = static_cast<byte*>(Memory::AlignPointer(mapping_bgn, alignment));
+    byte* const aligned_end = aligned_bgn + size;
+
+    if (aligned_bgn != mapping_bgn)
+    {
+      munmap(mapping_bgn, aligned_bgn - mapping_bgn);
+    }
+
+    if (aligned_end != mapping_end)
+    {
+      munmap(aligned_end, mapping_end - aligned_end);
+    }
+
+    return aligned_bgn;
+  }
+#endif
+}  // namespace HugePage
+
+void* Memory::VirtualMemoryAllocateHuge(const MemoryIndex size, const MemoryIndex huge_page_size, const bool allow_fallback, HugePageBacking* const out_backing) noexcept
+{
+  bfMemAssert(IsSizeAligned(size, huge_page_size), "Size must be a multiple of the huge page size.");
+
+  HugePageBacking backing = HugePageBacking::NONE;
+  void*           ptr     = nullptr;
+
+#if defined(_WIN32)
+  const MemoryIndex large_page_size = MemoryIndex(GetLargePageMinimum());
+
+  if (large_page_size != 0u && size % large_page_size == 0u)
+  {
+    ptr = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+
+    if (ptr)
+    {
+      backing = HugePageBacking::EXPLICIT;
+    }
+  }
+
+  // There is no transparent huge page equivalent, plain allocations are only aligned to the 64KiB allocation granularity.
+  if (!ptr && allow_fallback)
+  {
+    ptr = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+
+    if (ptr)
+    {
+      backing = HugePageBacking::NORMAL;
+    }
+  }
+#else
+#if defined(MAP_HUGETLB)
+  {
+    int huge_page_flags = MAP_HUGETLB;
+
+#if defined(MAP_HUGE_SHIFT)
+    int huge_page_shift = 0;
+
+    while ((MemoryIndex(1u) << huge_page_shift) < huge_page_size)
+    {
+      ++huge_page_shift;
+    }
+
+    huge_page_flags |= huge_page_shift << MAP_HUGE_SHIFT;
+#endif
+
+    void* const mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | huge_page_flags, -1, 0);
+
+    if (mapping != MAP_FAILED)
+    {
+      ptr     = mapping;
+      backing = HugePageBacking::EXPLICIT;
+    }
+  }
+#endif
+
+  if (!ptr && allow_fallback)
+  {
+    ptr = HugePage::MapAligned(size, huge_page_size < HugePageSize2MiB ? huge_page_size : HugePageSize2MiB);
+
+    if (ptr)
+    {
+#if defined(MADV_HUGEPAGE)
+      backing = madvise(ptr, size, MADV_HUGEPAGE) == 0 ? HugePageBacking::TRANSPARENT : HugePageBacking::NORMAL;
+#else
+      backing = HugePageBacking::NORMAL;
+#endif
+    }
+  }
+#endif
+
+  if (out_backing)
+  {
+    *out_backing = backing;
+  }
+
+  return ptr;
+}
+
+//-------------------------------------------------------------------------------------//
+// Virtual Linear Allocator
+//-------------------------------------------------------------------------------------//
+
+namespace VirtualLinear
+{
+  static constexpr MemoryIndex MinCommitSize = bfKilobytes(64);  //!< Commit in larger steps than a page to cut down on syscalls.
+}
+
+Memory::VirtualLinearAllocator::VirtualLinearAllocator(const MemoryIndex reserve_size, const MemoryIndex retained_commit_size) noexcept :
+  m_MemoryBgn{nullptr},
+  m_MemoryEnd{nullptr},
+  m_Current{nullptr},
+  m_CommitEnd{nullptr},
+  m_CommitGranularity{AlignSize(VirtualLinear::MinCommitSize, VirtualMemoryPageSize())},
+  m_RetainedCommitSize{retained_commit_size}
+{
+  const MemoryIndex aligned_reserve_size = AlignSize(reserve_size, m_CommitGranularity);
+  byte* const       memory               = static_cast<byte*>(VirtualMemoryReserve(aligned_reserve_size));
+
+  if (memory)
+  {
+    m_MemoryBgn = memory;
+    m_MemoryEnd = memory + aligned_reserve_size;
+    m_Current   = memory;
+    m_CommitEnd = memory;
+  }
+}
+
+void Memory::VirtualLinearAllocator::Clear() noexcept
+{
+  RewindTo(m_MemoryBgn);
+}
+
+bool Memory::VirtualLinearAllocator::CanServiceAllocation(const MemoryIndex size, const MemoryIndex alignment) const noexcept
+{
+  const void* const aligned_ptr = AlignPointer(m_Current, alignment);
+
+  return m_MemoryBgn && (reinterpret_cast<const byte*>(aligned_ptr) + size) <= m_MemoryEnd;
+}
+
+AllocationResult Memory::VirtualLinearAllocator::Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo&) noexcept
+{
+  if (size != 0u && CanServiceAllocation(size, alignment))
+  {
+    void* const aligned_ptr     = AlignPointer(m_Current, alignment);
+    byte* const aligned_ptr_end = static_cast<byte*>(aligned_ptr) + size;
+
+    if (CommitUpTo(aligned_ptr_end))
+    {
+      m_Current = aligned_ptr_end;
+      return AllocationResult(aligned_ptr, size);
+    }
+  }
+
+  return AllocationResult::Null();
+}
+
+void Memory::VirtualLinearAllocator::Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) noexcept
+{
+  (void)alignment;
+
+  bfMemAssert(IsPtrInRange(ptr), "That allocation did not come from this allocator.");
+
+  const byte* const ptr_end = static_cast<const byte*>(ptr) + size;
+
+  if (ptr_end == m_Current)
+  {
+    m_Current = static_cast<byte*>(ptr);
+  }
+}
+
+AllocationResult Memory::VirtualLinearAllocator::Resize(void* const ptr, const MemoryIndex old_size, const MemoryIndex new_size, const MemoryIndex alignment, const AllocationSourceInfo&) noexcept
+{
+  (void)alignment;
+
+  bfMemAssert(IsPtrInRange(ptr), "That allocation did not come from this allocator.");
+
+  byte* const block_bgn = static_cast<byte*>(ptr);
+
+  if (block_bgn + old_size == m_Current)
+  {
+    if (new_size <= MemoryIndex(m_MemoryEnd - block_bgn) && CommitUpTo(block_bgn + new_size))
+    {
+      m_Current = block_bgn + new_size;
+      return AllocationResult(ptr, new_size);
+    }
+  }
+  else if (new_size <= old_size)
+  {
+    return AllocationResult(ptr, new_size);
+  }
+
+  return AllocationResult::Null();
+}
+
+void Memory::VirtualLinearAllocator::QueryStats(AllocatorStats& out_stats) const noexcept
+{
+  const byte* const aligned_current = static_cast<const byte*>(AlignPointer(m_Current, DefaultAlignment));
+
+  out_stats.total_bytes        = TotalMemory();
+  out_stats.used_bytes         = UsedMemory();
+  out_stats.free_bytes         = m_MemoryEnd - m_Current;
+  out_stats.overhead_bytes     = 0u;
+  out_stats.largest_free_block = aligned_current < m_MemoryEnd ? MemoryIndex(m_MemoryEnd - aligned_current) : 0u;
+  out_stats.num_free_blocks    = out_stats.free_bytes != 0u ? 1u : 0u;
+}
+
+Memory::VirtualLinearAllocator::~VirtualLinearAllocator() noexcept
+{
+  if (m_MemoryBgn)
+  {
+    VirtualMemoryRelease(m_MemoryBgn, TotalMemory());
+  }
+}
+
+bool Memory::VirtualLinearAllocator::CommitUpTo(byte* const end) noexcept
+{
+  if (end > m_CommitEnd)
+  {
+    // Rounded from the start of the reservation since only it is known to be page aligned,
+    // the clamp keeps a partial last step from committing pages past the reservation.
+    const MemoryIndex commit_size    = AlignSize(MemoryIndex(end - m_MemoryBgn), m_CommitGranularity);
+    byte* const       new_commit_end = m_MemoryBgn + (commit_size < TotalMemory() ? commit_size : TotalMemory());
+
+    if (!VirtualMemoryCommit(m_CommitEnd, new_commit_end - m_CommitEnd))
+    {
+      return false;
+    }
+
+    m_CommitEnd = new_commit_end;
+  }
+
+  return true;
+}
+
+void Memory::VirtualLinearAllocator::RewindTo(byte* const restore_point) noexcept
+{
+  m_Current = restore_point;
+
+  if (m_RetainedCommitSize != RetainAllCommitted)
+  {
+    const MemoryIndex used_size   = UsedMemory();
+    const MemoryIndex keep_size   = AlignSize(used_size > m_RetainedCommitSize ? used_size : m_RetainedCommitSize, m_CommitGranularity);
+    const MemoryIndex commit_size = CommittedMemory();
+
+    if (keep_size < commit_size)
+    {
+      byte* const keep_end = m_MemoryBgn + keep_size;
+
+      VirtualMemoryDecommit(keep_end, commit_size - keep_size);
+      m_CommitEnd = keep_end;
+    }
+  }
+}
+
+void Memory::VirtualLinearAllocatorSavePoint::Save(VirtualLinearAllocator& allocator) noexcept
+{
+  m_Allocator    = &allocator;
+  m_RestorePoint = allocator.m_Current;
+}
+
+void Memory::VirtualLinearAllocatorSavePoint::Restore() noexcept
+{
+  bfMemAssert(m_Allocator != nullptr, "Savepoint must be active before restore can be called.");
+
+  m_Allocator->RewindTo(m_RestorePoint);
+  m_Allocator = nullptr;
+}
+
+//-------------------------------------------------------------------------------------//
+// Huge Page Allocator
+//-------------------------------------------------------------------------------------//
+
+Memory::HugePageAllocator::HugePageAllocator(const MemoryIndex huge_page_size, const bool allow_fallback) noexcept :
+  m_HugePageSize{huge_page_size},
+  m_AllowFallback{allow_fallback}
+{
+  bfMemAssert(IsValidAlignment(huge_page_size) && huge_page_size >= VirtualMemoryPageSize(), "Huge page size must be a power of two multiple of the page size.");
+}
+
+MemoryIndex Memory::HugePageAllocator::ChunkSize(const MemoryIndex size) const noexcept
+{
+  return AlignSize(size, m_HugePageSize);
+}
+
+AllocationResult Memory::HugePageAllocator::Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo&) const noexcept
+{
+  if (size != 0u && alignment <= m_HugePageSize)
+  {
+    const MemoryIndex allocation_size = ChunkSize(size);
+    void* const       ptr             = VirtualMemoryAllocateHuge(allocation_size, m_HugePageSize, m_AllowFallback);
+
+    if (ptr && IsPointerAligned(ptr, alignment))
+    {
+      return AllocationResult(ptr, allocation_size);
+    }
+
+    if (ptr)
+    {
+      VirtualMemoryRelease(ptr, allocation_size);
+    }
+  }
+
+  return AllocationResult::Null();
+}
+
+void Memory::HugePageAllocator::Deallocate(void* const ptr, const MemoryIndex size, const MemoryIndex alignment) const noexcept
+{
+  (void)alignment;
+
+  if (ptr)
+  {
+    VirtualMemoryRelease(ptr, ChunkSize(size));
+  }
+}
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/
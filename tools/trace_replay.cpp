@@ -0,0 +1,484 @@
+/******************************************************************************/
+/*!
+ * @file   trace_replay.cpp
+ * @author Shareef Raheem (https://blufedora.github.io/)
+ * @brief
+ *   Replays allocation traces recorded by `TraceMemoryTracking` against each
+ *   allocator in the library to compare them on a real allocation pattern.
+ *
+ *   Build with `-DBF_MEMORY_BUILD_TOOLS=ON` in a release configuration.
+ *
+ *   ```
+ *   LibFoundation_Memory_TraceReplay [--allocator=<name>] [--iterations=<n>] [--allocator-id=<id>] <prefix>.*.bftrace
+ *   ```
+ *
+ * @copyright Copyright (c) 2026 Shareef Abdoul-Raheem
+ */
+/******************************************************************************/
+#include "memory/default_heap.hpp"
+#include "memory/fixed_st_allocators.hpp"
+#include "memory/growing_mt_allocators.hpp"
+#include "memory/growing_st_allocators.hpp"
+#include "memory/tracking_policies.hpp"
+
+#include <algorithm>      // stable_sort, max
+#include <chrono>         // steady_clock
+#include <cstddef>        // max_align_t
+#include <cstdint>        // uint64_t, uint32_t, uint16_t
+#include <cstdio>         // fopen, fread, fclose, printf, fprintf
+#include <cstdlib>        // malloc, free, strtoull
+#include <cstring>        // memcmp, strncmp, strcmp
+#include <memory>         // unique_ptr
+#include <unordered_map>  // unordered_map
+#include <vector>         // vector
+
+using namespace Memory;
+
+//-------------------------------------------------------------------------------------//
+// Trace Loading
+//-------------------------------------------------------------------------------------//
+
+namespace
+{
+  constexpr std::uint32_t NoAllocatorFilter = 0xFFFFFFFFu;
+
+  struct ReplayOp
+  {
+    std::uint32_t slot;         //!< Index into the live pointer table.
+    bool          is_allocate;  //!<
+    MemoryIndex   size;         //!< A deallocation uses the size of its allocation.
+    MemoryIndex   alignment;    //!<
+  };
+
+  struct ReplayTrace
+  {
+    std::vector<ReplayOp> ops;
+    std::uint32_t         num_slots           = 0u;
+    std::uint64_t         num_records         = 0u;
+    std::uint64_t         num_unmatched_frees = 0u;  //!< Frees of allocations made before the oldest record still in the ring.
+    std::uint64_t         num_reused_address  = 0u;  //!< Allocations of an address that was still live, is a traced parent and child.
+    MemoryIndex           peak_live_bytes     = 0u;
+  };
+
+  bool LoadTraceFile(const char* const path, std::vector<MemoryTraceRecord>& out_records)
+  {
+    std::FILE* const file = std::fopen(path, "rb");
+
+    if (!file)
+    {
+      std::fprintf(stderr, "Failed to open '%s'.\n", path);
+      return false;
+    }
+
+    MemoryTraceFileHeader header;
+    bool                  is_valid = std::fread(&header, sizeof(header), 1u, file) == 1u &&
+                    std::memcmp(header.magic, "BFTRACE", sizeof(header.magic)) == 0 &&
+                    header.version == MemoryTraceFileVersion &&
+                    header.record_size == sizeof(MemoryTraceRecord);
+
+    if (is_valid)
+    {
+      std::vector<MemoryTraceRecord> ring(std::size_t(header.capacity));
+
+      const std::uint64_t num_valid = header.num_written < header.capacity ? header.num_written : header.capacity;
+      const std::uint64_t oldest    = header.num_written < header.capacity ? 0u : header.num_written % header.capacity;
+
+      is_valid = num_valid == 0u || std::fread(ring.data(), sizeof(MemoryTraceRecord), std::size_t(header.capacity), file) == header.capacity;
+
+      for (std::uint64_t index = 0u; is_valid && index < num_valid; ++index)
+      {
+        out_records.push_back(ring[std::size_t((oldest + index) % header.capacity)]);
+      }
+
+      if (is_valid)
+      {
+        std::printf("Loaded %llu records from thread %llu (%s)%s\n", (unsigned long long)num_valid, (unsigned long long)header.thread_id, path, header.num_written > header.capacity ? ", ring wrapped" : "");
+      }
+    }
+
+    if (!is_valid)
+    {
+      std::fprintf(stderr, "'%s' is not a version %u trace file.\n", path, unsigned(MemoryTraceFileVersion));
+    }
+
+    std::fclose(file);
+    return is_valid;
+  }
+
+  struct AddressKey
+  {
+    std::uint64_t address;
+    std::uint16_t allocator_id;
+
+    bool operator==(const AddressKey& rhs) const { return address == rhs.address && allocator_id == rhs.allocator_id; }
+  };
+
+  struct AddressKeyHash
+  {
+    std::size_t operator()(const AddressKey& key) const { return std::size_t((key.address ^ (std::uint64_t(key.allocator_id) << 56u)) * 0x9E3779B97F4A7C15ull >> 16u); }
+  };
+
+  // Merges the threads by time and turns addresses into slots so the replay loop does no lookups.
+  ReplayTrace BuildReplay(std::vector<MemoryTraceRecord>& records, const std::uint32_t allocator_filter)
+  {
+    std::stable_sort(records.begin(), records.end(), [](const MemoryTraceRecord& lhs, const MemoryTraceRecord& rhs) {
+      return lhs.timestamp < rhs.timestamp;
+    });
+
+    struct LiveAllocation
+    {
+      std::uint32_t slot;
+      MemoryIndex   size;
+      MemoryIndex   alignment;
+    };
+
+    ReplayTrace                                                   trace;
+    std::unordered_map<AddressKey, LiveAllocation, AddressKeyHash> live;
+    std::vector<std::uint32_t>                                    free_slots;
+    MemoryIndex                                                   live_bytes = 0u;
+
+    const auto Free = [&](const LiveAllocation& allocation) {
+      trace.ops.push_back(ReplayOp{allocation.slot, false, allocation.size, allocation.alignment});
+      free_slots.push_back(allocation.slot);
+      live_bytes -= allocation.size;
+    };
+
+    for (const MemoryTraceRecord& record : records)
+    {
+      if (allocator_filter != NoAllocatorFilter && record.allocator_id != allocator_filter)
+      {
+        continue;
+      }
+
+      ++trace.num_records;
+
+      const AddressKey key = {record.address, record.allocator_id};
+      const auto       it  = live.find(key);
+
+      if (record.op == MemoryTraceOp::ALLOCATE)
+      {
+        if (it != live.end())
+        {
+          ++trace.num_reused_address;
+          Free(it->second);
+          live.erase(it);
+        }
+
+        LiveAllocation allocation;
+        allocation.size      = MemoryIndex(record.size);
+        allocation.alignment = MemoryIndex(1u) << record.log2_alignment;
+
+        if (free_slots.empty())
+        {
+          allocation.slot = trace.num_slots++;
+        }
+        else
+        {
+          allocation.slot = free_slots.back();
+          free_slots.pop_back();
+        }
+
+        trace.ops.push_back(ReplayOp{allocation.slot, true, allocation.size, allocation.alignment});
+        live.emplace(key, allocation);
+
+        live_bytes += allocation.size;
+        trace.peak_live_bytes = std::max(trace.peak_live_bytes, live_bytes);
+      }
+      else if (it != live.end())
+      {
+        Free(it->second);
+        live.erase(it);
+      }
+      else
+      {
+        ++trace.num_unmatched_frees;
+      }
+    }
+
+    // Whatever was still alive at the end of the trace is freed so each replay leaves the allocator empty.
+    for (const auto& entry : live)
+    {
+      Free(entry.second);
+    }
+
+    return trace;
+  }
+}  // namespace
+
+//-------------------------------------------------------------------------------------//
+// Replay Targets
+//-------------------------------------------------------------------------------------//
+
+namespace
+{
+  struct MallocAllocator
+  {
+    AllocationResult Allocate(const MemoryIndex size, const MemoryIndex alignment, const AllocationSourceInfo&) noexcept
+    {
+      if (alignment > alignof(std::max_align_t))
+      {
+        return AllocationResult::Null();
+      }
+
+      return AllocationResult{std::malloc(size), size};
+    }
+
+    void Deallocate(void* const ptr, const MemoryIndex, const MemoryIndex) noexcept
+    {
+      std::free(ptr);
+    }
+  };
+
+  using MallocHeap = Allocator<MallocAllocator, AllocationMarkPolicy::UNMARKED, BoundCheckingPolicy::UNCHECKED>;
+
+  MallocHeap& ParentHeap()
+  {
+    static MallocHeap s_Heap{};
+    return s_Heap;
+  }
+
+  // Fixed size allocators get twice the trace's peak to leave room for fragmentation.
+  MemoryIndex ArenaSizeFor(const ReplayTrace& trace)
+  {
+    return trace.peak_live_bytes * 2u + bfMegabytes(1);
+  }
+
+  //
+  // Each target constructs a fresh allocator from the trace.
+  //
+
+  struct MallocTarget
+  {
+    MallocAllocator allocator;
+    explicit MallocTarget(const ReplayTrace&) {}
+  };
+
+  struct DefaultHeapTarget
+  {
+    IPolymorphicAllocator& allocator = DefaultHeap();
+    explicit DefaultHeapTarget(const ReplayTrace&) {}
+  };
+
+  struct FreeListTarget
+  {
+    std::unique_ptr<byte[]> memory;
+    FreeListAllocator       allocator;
+
+    explicit FreeListTarget(const ReplayTrace& trace) :
+      memory{new byte[ArenaSizeFor(trace)]},
+      allocator{memory.get(), ArenaSizeFor(trace)}
+    {
+    }
+  };
+
+  struct TLSFTarget
+  {
+    std::unique_ptr<byte[]> memory;
+    TLSFAllocator           allocator;
+
+    explicit TLSFTarget(const ReplayTrace& trace) :
+      memory{new byte[ArenaSizeFor(trace)]},
+      allocator{memory.get(), ArenaSizeFor(trace)}
+    {
+    }
+  };
+
+  // Sizes above 1024 go to the fallback.
+  struct SizeClassPoolTarget
+  {
+    SizeClassPoolAllocator<16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024> allocator{ParentHeap(), ParentHeap()};
+    explicit SizeClassPoolTarget(const ReplayTrace&) {}
+  };
+
+  struct ThreadCacheTarget
+  {
+    ThreadCacheAllocator allocator{ParentHeap()};
+    explicit ThreadCacheTarget(const ReplayTrace&) {}
+  };
+
+  struct ReplayResult
+  {
+    double        seconds;
+    std::uint64_t num_failed;
+  };
+
+  template<typename Target>
+  ReplayResult Replay(const ReplayTrace& trace)
+  {
+    using Clock = std::chrono::steady_clock;
+
+    Target             target{trace};
+    std::vector<void*> slots(trace.num_slots, nullptr);
+    std::uint64_t      num_failed = 0u;
+
+    const Clock::time_point start = Clock::now();
+
+    for (const ReplayOp& op : trace.ops)
+    {
+      if (op.is_allocate)
+      {
+        void* const ptr = target.allocator.Allocate(op.size, op.alignment, MemoryMakeAllocationSourceInfo()).ptr;
+
+        num_failed += ptr == nullptr;
+        slots[op.slot] = ptr;
+      }
+      else if (slots[op.slot])
+      {
+        target.allocator.Deallocate(slots[op.slot], op.size, op.alignment);
+        slots[op.slot] = nullptr;
+      }
+    }
+
+    const Clock::time_point end = Clock::now();
+
+    return ReplayResult{std::chrono::duration<double>(end - start).count(), num_failed};
+  }
+
+  struct ReplayTarget
+  {
+    const char* name;
+    ReplayResult (*replay)(const ReplayTrace& trace);
+  };
+
+  const ReplayTarget k_Targets[] = {
+   {"malloc", &Replay<MallocTarget>},
+   {"default_heap", &Replay<DefaultHeapTarget>},
+   {"free_list", &Replay<FreeListTarget>},
+   {"tlsf", &Replay<TLSFTarget>},
+   {"size_class_pool", &Replay<SizeClassPoolTarget>},
+   {"thread_cache", &Replay<ThreadCacheTarget>},
+  };
+
+  void PrintUsage(const char* const program)
+  {
+    std::fprintf(stderr, "Usage: %s [--allocator=<name>] [--iterations=<n>] [--allocator-id=<id>] <trace files...>\n  allocators:", program);
+
+    for (const ReplayTarget& target : k_Targets)
+    {
+      std::fprintf(stderr, " %s", target.name);
+    }
+
+    std::fprintf(stderr, "\n");
+  }
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  const char*                    allocator_name   = nullptr;
+  std::uint64_t                  num_iterations   = 5u;
+  std::uint32_t                  allocator_filter = NoAllocatorFilter;
+  std::vector<MemoryTraceRecord> records;
+  bool                           has_files = false;
+
+  for (int index = 1; index < argc; ++index)
+  {
+    const char* const arg = argv[index];
+
+    if (std::strncmp(arg, "--allocator=", 12u) == 0)
+    {
+      allocator_name = arg + 12u;
+    }
+    else if (std::strncmp(arg, "--iterations=", 13u) == 0)
+    {
+      num_iterations = std::strtoull(arg + 13u, nullptr, 10);
+    }
+    else if (std::strncmp(arg, "--allocator-id=", 15u) == 0)
+    {
+      allocator_filter = std::uint32_t(std::strtoull(arg + 15u, nullptr, 10));
+    }
+    else if (arg[0] == '-')
+    {
+      PrintUsage(argv[0]);
+      return 1;
+    }
+    else
+    {
+      if (!LoadTraceFile(arg, records))
+      {
+        return 1;
+      }
+
+      has_files = true;
+    }
+  }
+
+  if (!has_files || num_iterations == 0u)
+  {
+    PrintUsage(argv[0]);
+    return 1;
+  }
+
+  const ReplayTrace trace = BuildReplay(records, allocator_filter);
+
+  std::printf("Replaying %llu records as %llu operations, peak live %zu bytes, %llu unmatched frees, %llu reused addresses.\n\n",
+              (unsigned long long)trace.num_records,
+              (unsigned long long)trace.ops.size(),
+              trace.peak_live_bytes,
+              (unsigned long long)trace.num_unmatched_frees,
+              (unsigned long long)trace.num_reused_address);
+
+  std::printf("%-16s %12s %12s %12s %10s\n", "allocator", "best ms", "mean ms", "ns / op", "failed");
+
+  bool found_allocator = false;
+
+  for (const ReplayTarget& target : k_Targets)
+  {
+    if (allocator_name && std::strcmp(allocator_name, target.name) != 0)
+    {
+      continue;
+    }
+
+    found_allocator = true;
+
+    double        best_seconds  = 0.0;
+    double        total_seconds = 0.0;
+    std::uint64_t num_failed    = 0u;
+
+    for (std::uint64_t iteration = 0u; iteration < num_iterations; ++iteration)
+    {
+      const ReplayResult result = target.replay(trace);
+
+      best_seconds = iteration == 0u ? result.seconds : std::min(best_seconds, result.seconds);
+      total_seconds += result.seconds;
+      num_failed = result.num_failed;
+    }
+
+    const double ns_per_op = trace.ops.empty() ? 0.0 : best_seconds * 1e9 / double(trace.ops.size());
+
+    std::printf("%-16s %12.3f %12.3f %12.2f %10llu\n", target.name, best_seconds * 1e3, total_seconds * 1e3 / double(num_iterations), ns_per_op, (unsigned long long)num_failed);
+  }
+
+  if (!found_allocator)
+  {
+    PrintUsage(argv[0]);
+    return 1;
+  }
+
+  return 0;
+}
+
+/******************************************************************************/
+/*
+  MIT License
+
+  Copyright (c) 2026 Shareef Abdoul-Raheem
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+/******************************************************************************/